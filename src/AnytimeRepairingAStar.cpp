@@ -0,0 +1,389 @@
+#include "AnytimeRepairingAStar.h"
+#include "Map.h"
+#include <iostream>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <cstdlib>
+
+namespace {
+    const int kDirectionX[4] = {0, 1, 0, -1};
+    const int kDirectionY[4] = {-1, 0, 1, 0};
+
+    const int kUnknownCost = std::numeric_limits<int>::max();
+
+    // Expansions between two clock reads
+    const int kExpansionsPerTimeCheck = 64;
+}
+
+// ******************** CONSTRUCTOR & DESTRUCTOR ********************
+
+AnytimeRepairingAStar::AnytimeRepairingAStar()
+        : phase_(Phase::IDLE), width_(0), height_(0), map_revision_(0),
+          epsilon_(1.0f), epsilon_step_(0.5f), initial_epsilon_(1.0f), suboptimality_bound_(0.0f),
+          solution_cost_(0), solution_version_(0), iteration_(0), expansions_(0) {
+}
+
+AnytimeRepairingAStar::~AnytimeRepairingAStar() {
+    // No dynamic cleanup needed
+}
+
+// ******************** PLANNING ********************
+
+template<typename TileContainer>
+void AnytimeRepairingAStar::Begin(const Map<TileContainer>& game_map, const Position& start, const Position& goal,
+                                  float initial_epsilon, float epsilon_step) {
+    Reset();
+
+    // The search keeps per-tile state for the whole map, which a streamed world cannot hold
+    if (IsStreamedTileContainer<TileContainer>::value) {
+        std::cout << "ARA* needs the whole map; not available on streamed maps" << std::endl;
+        width_ = 0;
+        height_ = 0;
+        map_revision_ = game_map.GetRevision();
+        phase_ = Phase::DONE;
+        return;
+    }
+
+    width_ = game_map.GetWidth();
+    height_ = game_map.GetHeight();
+    start_ = start;
+    goal_ = goal;
+    map_revision_ = game_map.GetRevision();
+    initial_epsilon_ = std::max(1.0f, initial_epsilon);
+    epsilon_ = initial_epsilon_;
+    epsilon_step_ = std::max(0.01f, epsilon_step);
+
+    size_t tile_count = static_cast<size_t>(width_) * height_;
+    traversable_.assign(tile_count, 0);
+    for (int y = 0; y < height_; ++y) {
+        for (int x = 0; x < width_; ++x) {
+            traversable_[y * width_ + x] = game_map.GetTile(x, y).IsTraversable() ? 1 : 0;
+        }
+    }
+
+    g_costs_.assign(tile_count, kUnknownCost);
+    closed_iterations_.assign(tile_count, -1);
+    in_open_.assign(tile_count, 0);
+    in_inconsistent_.assign(tile_count, 0);
+
+    if (!IsFree(start.x, start.y) || !IsFree(goal.x, goal.y)) {
+        phase_ = Phase::DONE;
+        return;
+    }
+
+    g_costs_[GetIndex(goal)] = 0;
+    PushOpen(GetIndex(goal));
+    phase_ = Phase::SEARCHING;
+}
+
+template<typename TileContainer>
+bool AnytimeRepairingAStar::Continue(const Map<TileContainer>& game_map, long long time_budget_ns) {
+    if (phase_ == Phase::IDLE) {
+        return false;
+    }
+    if (map_revision_ != game_map.GetRevision() && !AdoptMapRevision(game_map)) {
+        Begin(game_map, start_, goal_, initial_epsilon_, epsilon_step_);
+    }
+    if (phase_ == Phase::DONE) {
+        return true;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(time_budget_ns);
+    while (ImprovePath(deadline)) {
+        if (g_costs_[GetIndex(start_)] == kUnknownCost) {
+            phase_ = Phase::DONE; // Open list ran empty: no path
+            return true;
+        }
+
+        PublishSolution();
+        if (epsilon_ <= 1.0f) {
+            phase_ = Phase::DONE;
+            return true;
+        }
+
+        epsilon_ = std::max(1.0f, epsilon_ - epsilon_step_);
+        StartIteration();
+
+        if (std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+    }
+    return false;
+}
+
+template<typename TileContainer>
+bool AnytimeRepairingAStar::AdoptMapRevision(const Map<TileContainer>& game_map) {
+    std::vector<Position> changed_tiles;
+    if (phase_ == Phase::IDLE || game_map.GetWidth() != width_ || game_map.GetHeight() != height_ ||
+        !game_map.GetTileChangesSince(map_revision_, changed_tiles)) {
+        return false;
+    }
+
+    // Costs only depend on which tiles can be entered
+    for (const Position& pos : changed_tiles) {
+        bool is_traversable = game_map.GetTile(pos).IsTraversable();
+        if (is_traversable != (traversable_[GetIndex(pos)] != 0)) {
+            return false;
+        }
+    }
+
+    map_revision_ = game_map.GetRevision();
+    return true;
+}
+
+void AnytimeRepairingAStar::Reset() {
+    phase_ = Phase::IDLE;
+    suboptimality_bound_ = 0.0f;
+    solution_cost_ = 0;
+    solution_version_ = 0;
+    iteration_ = 0;
+    expansions_ = 0;
+    open_heap_.clear();
+    inconsistent_.clear();
+}
+
+// ******************** SEARCH STEPS ********************
+
+// Expands tiles until the start's cost is no larger than the smallest key in the open list;
+// returns false when the deadline interrupts the iteration
+bool AnytimeRepairingAStar::ImprovePath(std::chrono::steady_clock::time_point deadline) {
+    int start_tile = GetIndex(start_);
+    int expansions_since_check = 0;
+
+    while (!open_heap_.empty()) {
+        OpenEntry entry = open_heap_.front();
+        int tile = std::get<2>(entry);
+        if (!in_open_[tile] || std::get<3>(entry) != g_costs_[tile]) {
+            std::pop_heap(open_heap_.begin(), open_heap_.end(), std::greater<OpenEntry>());
+            open_heap_.pop_back();
+            continue; // Stale entry
+        }
+
+        if (g_costs_[start_tile] != kUnknownCost && std::get<0>(entry) >= g_costs_[start_tile]) {
+            return true;
+        }
+
+        if (++expansions_since_check >= kExpansionsPerTimeCheck) {
+            expansions_since_check = 0;
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+        }
+
+        std::pop_heap(open_heap_.begin(), open_heap_.end(), std::greater<OpenEntry>());
+        open_heap_.pop_back();
+        in_open_[tile] = 0;
+        closed_iterations_[tile] = iteration_;
+        expansions_++;
+
+        int x = tile % width_;
+        int y = tile / width_;
+        int next_cost = g_costs_[tile] + 1;
+        for (int direction = 0; direction < 4; ++direction) {
+            int nx = x + kDirectionX[direction];
+            int ny = y + kDirectionY[direction];
+            if (!IsFree(nx, ny)) continue;
+
+            int neighbor = ny * width_ + nx;
+            if (g_costs_[neighbor] <= next_cost) continue;
+
+            g_costs_[neighbor] = next_cost;
+            if (closed_iterations_[neighbor] != iteration_) {
+                PushOpen(neighbor);
+            } else if (!in_inconsistent_[neighbor]) {
+                // Already expanded in this iteration; repaired by the next one
+                in_inconsistent_[neighbor] = 1;
+                inconsistent_.push_back(neighbor);
+            }
+        }
+    }
+
+    return true;
+}
+
+// Moves the inconsistent tiles into the open list and re-keys it for the new epsilon
+void AnytimeRepairingAStar::StartIteration() {
+    iteration_++;
+
+    std::vector<int> open_tiles;
+    open_tiles.reserve(open_heap_.size() + inconsistent_.size());
+    for (const OpenEntry& entry : open_heap_) {
+        int tile = std::get<2>(entry);
+        if (in_open_[tile] && std::get<3>(entry) == g_costs_[tile]) {
+            open_tiles.push_back(tile);
+        }
+    }
+    for (int tile : inconsistent_) {
+        in_inconsistent_[tile] = 0;
+        if (!in_open_[tile]) {
+            open_tiles.push_back(tile);
+        }
+    }
+    inconsistent_.clear();
+
+    open_heap_.clear();
+    for (int tile : open_tiles) {
+        in_open_[tile] = 1;
+        open_heap_.push_back(OpenEntry(Key(tile), Heuristic(tile), tile, g_costs_[tile]));
+    }
+    std::make_heap(open_heap_.begin(), open_heap_.end(), std::greater<OpenEntry>());
+}
+
+// The proven bound can be tighter than epsilon: no path is cheaper than the smallest
+// g + h over the tiles that are still open or inconsistent
+void AnytimeRepairingAStar::PublishSolution() {
+    int cost = g_costs_[GetIndex(start_)];
+
+    int lower_bound = cost;
+    for (const OpenEntry& entry : open_heap_) {
+        int tile = std::get<2>(entry);
+        if (in_open_[tile] && std::get<3>(entry) == g_costs_[tile]) {
+            lower_bound = std::min(lower_bound, g_costs_[tile] + Heuristic(tile));
+        }
+    }
+    for (int tile : inconsistent_) {
+        lower_bound = std::min(lower_bound, g_costs_[tile] + Heuristic(tile));
+    }
+
+    float proven_bound = (lower_bound > 0) ? static_cast<float>(cost) / lower_bound : 1.0f;
+    suboptimality_bound_ = std::min(epsilon_, proven_bound);
+
+    if (solution_version_ == 0 || cost < solution_cost_) {
+        solution_cost_ = cost;
+        solution_version_++;
+    }
+}
+
+void AnytimeRepairingAStar::PushOpen(int tile) {
+    in_open_[tile] = 1;
+    open_heap_.push_back(OpenEntry(Key(tile), Heuristic(tile), tile, g_costs_[tile]));
+    std::push_heap(open_heap_.begin(), open_heap_.end(), std::greater<OpenEntry>());
+}
+
+// ******************** PATH EXTRACTION ********************
+
+// Every known cost came from a neighbour that is now at least one cheaper, so walking to the
+// cheapest neighbour always ends at the goal, in no more steps than the tile's cost
+std::vector<Position> AnytimeRepairingAStar::ExtractPath(const Position& from) const {
+    std::vector<Position> path;
+    if (!IsFree(from.x, from.y) || g_costs_[GetIndex(from)] == kUnknownCost) {
+        return path;
+    }
+
+    Position current = from;
+    path.push_back(current);
+    while (!(current == goal_)) {
+        int best_cost = g_costs_[GetIndex(current)];
+        Position best = current;
+        for (int direction = 0; direction < 4; ++direction) {
+            int nx = current.x + kDirectionX[direction];
+            int ny = current.y + kDirectionY[direction];
+            if (IsFree(nx, ny) && g_costs_[ny * width_ + nx] < best_cost) {
+                best_cost = g_costs_[ny * width_ + nx];
+                best = Position(nx, ny);
+            }
+        }
+        if (best == current) {
+            path.clear();
+            break;
+        }
+        current = best;
+        path.push_back(current);
+    }
+    return path;
+}
+
+// ******************** PRIVATE HELPER METHODS ********************
+
+int AnytimeRepairingAStar::Heuristic(int tile) const {
+    return std::abs(tile % width_ - start_.x) + std::abs(tile / width_ - start_.y);
+}
+
+bool AnytimeRepairingAStar::IsFree(int x, int y) const {
+    return x >= 0 && x < width_ && y >= 0 && y < height_ && traversable_[y * width_ + x] != 0;
+}
+
+// ******************** EXPLICIT TEMPLATE INSTANTIATIONS ********************
+
+template void AnytimeRepairingAStar::Begin<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map, const Position& start, const Position& goal,
+        float initial_epsilon, float epsilon_step);
+
+template bool AnytimeRepairingAStar::Continue<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map, long long time_budget_ns);
+
+template bool AnytimeRepairingAStar::AdoptMapRevision<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map);
+
+// Flat row-major grid (the default Map<> container)
+
+template void AnytimeRepairingAStar::Begin<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map, const Position& start, const Position& goal,
+        float initial_epsilon, float epsilon_step);
+
+template bool AnytimeRepairingAStar::Continue<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map, long long time_budget_ns);
+
+template bool AnytimeRepairingAStar::AdoptMapRevision<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map);
+
+// Morton-ordered 8x8 blocks
+
+template void AnytimeRepairingAStar::Begin<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map, const Position& start, const Position& goal,
+        float initial_epsilon, float epsilon_step);
+
+template bool AnytimeRepairingAStar::Continue<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map, long long time_budget_ns);
+
+template bool AnytimeRepairingAStar::AdoptMapRevision<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map);
+
+// Type byte plus bit planes
+
+template void AnytimeRepairingAStar::Begin<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map, const Position& start, const Position& goal,
+        float initial_epsilon, float epsilon_step);
+
+template bool AnytimeRepairingAStar::Continue<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map, long long time_budget_ns);
+
+template bool AnytimeRepairingAStar::AdoptMapRevision<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map);
+
+// Build-time 64x64 grid
+
+template void AnytimeRepairingAStar::Begin<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map, const Position& start, const Position& goal,
+        float initial_epsilon, float epsilon_step);
+
+template bool AnytimeRepairingAStar::Continue<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map, long long time_budget_ns);
+
+template bool AnytimeRepairingAStar::AdoptMapRevision<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map);
+
+// Streamed 64x64 chunks
+
+template void AnytimeRepairingAStar::Begin<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map, const Position& start, const Position& goal,
+        float initial_epsilon, float epsilon_step);
+
+template bool AnytimeRepairingAStar::Continue<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map, long long time_budget_ns);
+
+template bool AnytimeRepairingAStar::AdoptMapRevision<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map);
+
+// Memory-mapped map file
+
+template void AnytimeRepairingAStar::Begin<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map, const Position& start, const Position& goal,
+        float initial_epsilon, float epsilon_step);
+
+template bool AnytimeRepairingAStar::Continue<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map, long long time_budget_ns);
+
+template bool AnytimeRepairingAStar::AdoptMapRevision<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map);
@@ -0,0 +1,109 @@
+#ifndef RAYLIBSTARTER_ANYTIMEREPAIRINGASTAR_H
+#define RAYLIBSTARTER_ANYTIMEREPAIRINGASTAR_H
+
+#include "Tile.h"
+#include <vector>
+#include <tuple>
+#include <chrono>
+#include <cstdint>
+
+// Forward declaration
+template<typename TileContainer> class Map;
+
+// ******************** ANYTIME REPAIRING A* ********************
+
+// ARA*: weighted A* with f = g + epsilon * h gives a first path quickly whose cost is at most
+// epsilon times the optimum; epsilon is then lowered step by step down to 1. Each iteration
+// reuses all costs found so far and only re-expands the tiles whose cost improved after they
+// were expanded (the inconsistent list), so no iteration starts from scratch.
+// The search runs backward from the goal: every tile's cost is a cost-to-goal that only ever
+// goes down, so a path can be extracted from any tile the agent has reached on an earlier path.
+class AnytimeRepairingAStar {
+public:
+    // Constructor
+    AnytimeRepairingAStar();
+
+    // Destructor
+    ~AnytimeRepairingAStar();
+
+    // Streamed maps are too large for the per-tile state; Begin on one finishes without a path
+    template<typename TileContainer>
+    void Begin(const Map<TileContainer>& game_map, const Position& start, const Position& goal,
+               float initial_epsilon = 3.0f, float epsilon_step = 0.5f);
+
+    // Searches until the time budget is used up; returns true once the path is optimal or no
+    // path exists. A change to the map's traversability restarts the search from the same start.
+    template<typename TileContainer>
+    bool Continue(const Map<TileContainer>& game_map, long long time_budget_ns);
+
+    // Takes on the map's current revision if no tile changed traversability since the one searched
+    // (e.g. a chest was opened), keeping all search effort; returns false if the search must restart
+    template<typename TileContainer>
+    bool AdoptMapRevision(const Map<TileContainer>& game_map);
+
+    void Reset();
+
+    // Solution state
+    bool IsDone() const { return phase_ == Phase::DONE; }
+    bool HasSolution() const { return solution_version_ > 0; }
+    int GetSolutionVersion() const { return solution_version_; } // Increases with every cheaper path
+    int GetSolutionCost() const { return solution_cost_; }
+    float GetSuboptimalityBound() const { return suboptimality_bound_; }
+    float GetEpsilon() const { return epsilon_; }
+    int GetExpansions() const { return expansions_; }
+    unsigned long long GetMapRevision() const { return map_revision_; }
+
+    // Path to the goal from any tile with a known cost (empty otherwise)
+    std::vector<Position> ExtractPath(const Position& from) const;
+
+private:
+    enum class Phase {
+        IDLE,
+        SEARCHING,
+        DONE
+    };
+
+    // f, h, tile, g at push time; ties on f go to the tile closer to the start
+    typedef std::tuple<float, int, int, int> OpenEntry;
+
+    Phase phase_;
+    int width_;
+    int height_;
+    Position start_;
+    Position goal_;
+    unsigned long long map_revision_;
+
+    float epsilon_;
+    float epsilon_step_;
+    float initial_epsilon_;
+    float suboptimality_bound_;
+    int solution_cost_;
+    int solution_version_;
+    int iteration_;
+    int expansions_;
+
+    // Per tile
+    std::vector<uint8_t> traversable_;
+    std::vector<int> g_costs_;              // Cost to the goal found so far
+    std::vector<int> closed_iterations_;    // Iteration in which the tile was last expanded
+    std::vector<uint8_t> in_open_;
+    std::vector<uint8_t> in_inconsistent_;
+
+    // Open heap with lazy deletion, and tiles improved after their expansion
+    std::vector<OpenEntry> open_heap_;
+    std::vector<int> inconsistent_;
+
+    // Search steps
+    bool ImprovePath(std::chrono::steady_clock::time_point deadline);
+    void StartIteration();
+    void PublishSolution();
+    void PushOpen(int tile);
+
+    // Helpers
+    int GetIndex(const Position& pos) const { return pos.y * width_ + pos.x; }
+    int Heuristic(int tile) const;
+    float Key(int tile) const { return g_costs_[tile] + epsilon_ * Heuristic(tile); }
+    bool IsFree(int x, int y) const;
+};
+
+#endif //RAYLIBSTARTER_ANYTIMEREPAIRINGASTAR_H
@@ -4,6 +4,7 @@
 #include "items/base-classes/AccessoryItem.h"
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
 
 // ******************** CONSTRUCTOR & DESTRUCTOR ********************
 
@@ -11,18 +12,25 @@ AutomatedTraversal::AutomatedTraversal()
         : is_active_(false)
         , is_complete_(false)
         , is_moving_(false)
+        , is_planning_(false)
+        , is_refining_path_(false)
+        , is_following_partial_path_(false)
         , show_path_visualization_(true)
         , current_step_(0)
         , target_position_(0, 0)
         , player_character_(nullptr)
         , game_map_(nullptr)
         , pathfinding_system_(nullptr)
+        , planning_budget_ns_(2000000)  // 2 ms of planning per frame
+        , path_version_(0)
+        , path_replanned_(false)
         , movement_timer_(0.0f)
         , movement_delay_(0.8f)  // 0.8 seconds between moves
         , status_message_("Ready for automated traversal")
         , items_picked_up_(0)
         , items_equipped_(0)
-        , total_items_found_(0) {
+        , total_items_found_(0)
+        , bombs_used_(0) {
 
     std::cout << "Automated Traversal System initialized." << std::endl;
 }
@@ -33,7 +41,8 @@ AutomatedTraversal::~AutomatedTraversal() {
 
 // ******************** MAIN TRAVERSAL METHODS ********************
 
-bool AutomatedTraversal::StartAutomatedTraversal(PlayerChar* player, Map<>* game_map, Pathfinding* pathfinder) {
+bool AutomatedTraversal::StartAutomatedTraversal(PlayerChar* player, Map<>* game_map, Pathfinding* pathfinder,
+                                                 const SearchLimits& limits) {
     if (!player || !game_map || !pathfinder) {
         std::cout << "Error: Invalid parameters for automated traversal!" << std::endl;
         return false;
@@ -43,6 +52,8 @@ bool AutomatedTraversal::StartAutomatedTraversal(PlayerChar* player, Map<>* game
     player_character_ = player;
     game_map_ = game_map;
     pathfinding_system_ = pathfinder;
+    search_limits_ = limits;
+    is_following_partial_path_ = false;
 
     // Calculate path from current player position to end
     Position start = player_character_->GetPosition();
@@ -52,7 +63,36 @@ bool AutomatedTraversal::StartAutomatedTraversal(PlayerChar* player, Map<>* game
     std::cout << "Calculating optimal path from (" << start.x << ", " << start.y
               << ") to (" << goal.x << ", " << goal.y << ")..." << std::endl;
 
-    PathResult result = pathfinding_system_->FindPathAStar(start, goal, *game_map_);
+    // With bombs in the inventory, plan over (tile, bombs left) so blasting is an option
+    PathResult result;
+    blast_positions_.clear();
+    int bomb_count = player_character_->GetInventorySystem().GetBombCount();
+    if (bomb_count > 0) {
+        std::cout << "💣 Carrying " << bomb_count << " bomb(s) - stone and bushes can be blasted" << std::endl;
+        BombPathResult bomb_result = pathfinding_system_->FindPathWithBombs(start, goal, *game_map_, bomb_count);
+        result = bomb_result.path_result;
+        blast_positions_ = bomb_result.blast_positions;
+    } else if (search_limits_.IsLimited()) {
+        return PlanLimitedPath(true);
+    } else if (!pathfinding_system_->HasUniformTerrainCosts()) {
+        // The anytime planner counts steps; weighted terrain needs the cost-aware A*
+        result = pathfinding_system_->FindPathAStar(start, goal, *game_map_);
+    } else {
+        // Anytime search: walk the first bounded path, switch to cheaper ones as they arrive
+        calculated_path_.clear();
+        anytime_planner_.Begin(*game_map_, start, goal);
+        path_version_ = 0;
+        path_replanned_ = false;
+
+        is_active_ = true;
+        is_complete_ = false;
+        is_moving_ = false;
+        is_refining_path_ = true;
+        status_message_ = "Planning path...";
+
+        ContinueAnytimePlanning();
+        return is_active_;
+    }
 
     if (!result.path_found) {
         std::cout << "❌ Cannot find path to destination! Automated traversal failed." << std::endl;
@@ -60,23 +100,15 @@ bool AutomatedTraversal::StartAutomatedTraversal(PlayerChar* player, Map<>* game
         return false;
     }
 
-    // Store the calculated path
-    calculated_path_ = result.path;
-    current_step_ = 0;
-
-    // Initialize state
-    is_active_ = true;
-    is_complete_ = false;
-    is_moving_ = true;
-    movement_timer_ = 0.0f;
-    items_picked_up_ = 0;
-    items_equipped_ = 0;
-    total_items_found_ = 0;
+    BeginMovement(result.path);
 
     std::cout << "✅ Path calculated successfully!" << std::endl;
     std::cout << "📊 Path length: " << calculated_path_.size() << " steps" << std::endl;
     std::cout << "💰 Path cost: " << result.total_cost << std::endl;
     std::cout << "🧠 Nodes explored: " << result.nodes_explored << std::endl;
+    if (!blast_positions_.empty()) {
+        std::cout << "💣 Bombs planned: " << blast_positions_.size() << std::endl;
+    }
     std::cout << "⏱️  Movement delay: " << movement_delay_ << " seconds per step" << std::endl;
     std::cout << "🎮 Starting automated movement..." << std::endl;
 
@@ -84,7 +116,51 @@ bool AutomatedTraversal::StartAutomatedTraversal(PlayerChar* player, Map<>* game
     return true;
 }
 
+bool AutomatedTraversal::StartLootTour(PlayerChar* player, Map<>* game_map, Pathfinding* pathfinder, int step_budget) {
+    if (!player || !game_map || !pathfinder) {
+        std::cout << "Error: Invalid parameters for loot tour!" << std::endl;
+        return false;
+    }
+
+    player_character_ = player;
+    game_map_ = game_map;
+    pathfinding_system_ = pathfinder;
+
+    Position start = player_character_->GetPosition();
+    Position goal = game_map_->GetEndPosition();
+    float carry_capacity = player_character_->GetMaxCarryWeight() - player_character_->GetCurrentWeight();
+
+    std::cout << "\n🗺️  PLANNING LOOT TOUR 🗺️" << std::endl;
+    std::cout << "From (" << start.x << ", " << start.y << ") to (" << goal.x << ", " << goal.y
+              << "), free carry weight: " << std::fixed << std::setprecision(1) << carry_capacity << " kg"
+              << std::setprecision(6) << std::defaultfloat << std::endl;
+
+    // The tour only walks traversable tiles
+    blast_positions_.clear();
+    calculated_path_.clear();
+    loot_planner_.Begin(*game_map_, start, goal, step_budget, carry_capacity);
+
+    is_active_ = true;
+    is_complete_ = false;
+    is_moving_ = false;
+    is_planning_ = true;
+    status_message_ = "Planning loot tour...";
+
+    // Small maps usually finish within the first slice
+    ContinueLootTourPlanning();
+    return is_active_;
+}
+
 void AutomatedTraversal::Update() {
+    if (is_active_ && is_planning_) {
+        ContinueLootTourPlanning();
+        return;
+    }
+
+    if (is_active_ && is_refining_path_) {
+        ContinueAnytimePlanning();
+    }
+
     if (!is_active_ || is_complete_ || !is_moving_) {
         return;
     }
@@ -106,6 +182,11 @@ void AutomatedTraversal::Stop() {
     is_active_ = false;
     is_complete_ = false;
     is_moving_ = false;
+    is_planning_ = false;
+    is_refining_path_ = false;
+    is_following_partial_path_ = false;
+    loot_planner_.Reset();
+    anytime_planner_.Reset();
     calculated_path_.clear();
     current_step_ = 0;
     status_message_ = "Traversal stopped";
@@ -113,9 +194,162 @@ void AutomatedTraversal::Stop() {
 
 // ******************** PRIVATE PROCESSING METHODS ********************
 
+void AutomatedTraversal::ContinueLootTourPlanning() {
+    if (!loot_planner_.Continue(*game_map_, planning_budget_ns_)) {
+        return; // Continue next frame
+    }
+
+    is_planning_ = false;
+    if (!loot_planner_.HasPath()) {
+        std::cout << "❌ No loot tour to the destination! Automated traversal failed." << std::endl;
+        is_active_ = false;
+        status_message_ = "No path to destination";
+        return;
+    }
+
+    loot_planner_.PrintPlan();
+    BeginMovement(loot_planner_.GetPath());
+
+    std::cout << "✅ Loot tour planned: " << calculated_path_.size() << " steps, "
+              << loot_planner_.GetTourStops().size() << " stops" << std::endl;
+    std::cout << "🎮 Starting automated movement..." << std::endl;
+    UpdateStatusMessage();
+}
+
+void AutomatedTraversal::ContinueAnytimePlanning() {
+    Position player_position = player_character_->GetPosition();
+
+    // Tiles that changed traversability invalidate the costs; replan from where the player stands.
+    // Other changes, like opened chests, keep the search going
+    if (anytime_planner_.GetMapRevision() != game_map_->GetRevision() &&
+        !anytime_planner_.AdoptMapRevision(*game_map_)) {
+        anytime_planner_.Begin(*game_map_, player_position, game_map_->GetEndPosition());
+        path_version_ = 0;
+        path_replanned_ = true;
+    }
+
+    bool planning_done = anytime_planner_.Continue(*game_map_, planning_budget_ns_);
+
+    if (anytime_planner_.GetSolutionVersion() != path_version_) {
+        path_version_ = anytime_planner_.GetSolutionVersion();
+        std::vector<Position> path = anytime_planner_.ExtractPath(player_position);
+
+        if (!is_moving_ && !path.empty()) {
+            BeginMovement(path);
+            path_replanned_ = false;
+            std::cout << "✅ First path found: " << calculated_path_.size() << " steps (within "
+                      << anytime_planner_.GetSuboptimalityBound() << "x of optimal)" << std::endl;
+            std::cout << "⏱️  Movement delay: " << movement_delay_ << " seconds per step" << std::endl;
+            std::cout << "🎮 Starting automated movement..." << std::endl;
+            UpdateStatusMessage();
+        } else if (is_moving_ && path.size() > 1) {
+            // The new path starts on the player's tile, which has already been visited.
+            // After a restart the old path may cross a tile that is now blocked: take the detour
+            // even if it is longer
+            int remaining_steps = static_cast<int>(calculated_path_.size()) - current_step_;
+            int new_steps = static_cast<int>(path.size()) - 1;
+            if (path_replanned_ || new_steps < remaining_steps) {
+                std::cout << (path_replanned_ ? "🔁 Replanned path: " : "🔁 Better path found: ")
+                          << remaining_steps << " -> " << new_steps
+                          << " remaining steps (within " << anytime_planner_.GetSuboptimalityBound()
+                          << "x of optimal)" << std::endl;
+                calculated_path_ = path;
+                current_step_ = 1;
+                path_replanned_ = false;
+                UpdateStatusMessage();
+            }
+        }
+    }
+
+    if (!planning_done) {
+        return; // Refine further next frame
+    }
+
+    is_refining_path_ = false;
+    if (!anytime_planner_.HasSolution()) {
+        std::cout << "❌ Cannot find path to destination! Automated traversal failed." << std::endl;
+        is_active_ = false;
+        is_moving_ = false;
+        status_message_ = "No path to destination";
+        return;
+    }
+
+    std::cout << "🏁 Path refinement finished after " << anytime_planner_.GetExpansions()
+              << " expansions (optimal cost " << anytime_planner_.GetSolutionCost() << ")" << std::endl;
+}
+
+// Capped A* from the player's tile. A partial result is walked like a full path; HandlePathEnd
+// searches again from its end, which is strictly closer to the goal by the heuristic.
+bool AutomatedTraversal::PlanLimitedPath(bool first_leg) {
+    Position start = player_character_->GetPosition();
+    Position goal = game_map_->GetEndPosition();
+    PathResult result = pathfinding_system_->FindPathAStar(start, goal, *game_map_, search_limits_);
+
+    if (!result.path_found && !(result.is_partial && result.path.size() > 1)) {
+        if (result.is_partial) {
+            std::cout << "❌ No tile closer to the destination within the search limit! Automated traversal failed."
+                      << std::endl;
+        } else {
+            std::cout << "❌ Cannot find path to destination! Automated traversal failed." << std::endl;
+        }
+        is_active_ = false;
+        is_moving_ = false;
+        is_following_partial_path_ = false;
+        status_message_ = "No path to destination";
+        return false;
+    }
+
+    is_following_partial_path_ = result.is_partial;
+    if (first_leg) {
+        BeginMovement(result.path);
+        std::cout << "⏱️  Movement delay: " << movement_delay_ << " seconds per step" << std::endl;
+        std::cout << "🎮 Starting automated movement..." << std::endl;
+    } else {
+        // The player already stands on the first tile
+        calculated_path_ = result.path;
+        current_step_ = 1;
+    }
+
+    if (result.is_partial) {
+        std::cout << "🧭 Search limit reached after " << result.nodes_explored << " nodes: walking "
+                  << result.path.size() - 1 << " steps toward (" << result.path.back().x << ", "
+                  << result.path.back().y << ") before searching again" << std::endl;
+    } else {
+        std::cout << "✅ Path calculated: " << result.path.size() << " steps, "
+                  << result.nodes_explored << " nodes explored" << std::endl;
+    }
+
+    UpdateStatusMessage();
+    return true;
+}
+
+void AutomatedTraversal::HandlePathEnd() {
+    if (is_following_partial_path_) {
+        PlanLimitedPath(false);
+        return;
+    }
+    CompleteTraversal();
+}
+
+void AutomatedTraversal::BeginMovement(const std::vector<Position>& path) {
+    // Store the calculated path
+    calculated_path_ = path;
+    current_step_ = 0;
+
+    // Initialize state
+    is_active_ = true;
+    is_complete_ = false;
+    is_moving_ = true;
+    movement_timer_ = 0.0f;
+    items_picked_up_ = 0;
+    items_equipped_ = 0;
+    total_items_found_ = 0;
+    bombs_used_ = 0;
+}
+
 void AutomatedTraversal::ProcessCurrentStep() {
     if (current_step_ >= static_cast<int>(calculated_path_.size())) {
-        CompleteTraversal();
+        HandlePathEnd();
         return;
     }
 
@@ -124,6 +358,14 @@ void AutomatedTraversal::ProcessCurrentStep() {
     std::cout << "🚶 Step " << (current_step_ + 1) << "/" << calculated_path_.size()
               << ": Moving to (" << next_position.x << ", " << next_position.y << ")" << std::endl;
 
+    // Clear a planned blast tile before stepping onto it
+    if (!game_map_->GetTile(next_position).IsTraversable() && !BlastTile(next_position)) {
+        std::cout << "🧱 Path blocked at (" << next_position.x << ", " << next_position.y
+                  << ")! Stopping traversal." << std::endl;
+        Stop();
+        return;
+    }
+
     // Move player to next position
     player_character_->SetPosition(next_position);
 
@@ -139,8 +381,25 @@ void AutomatedTraversal::ProcessCurrentStep() {
 
     // Check if we've reached the end
     if (current_step_ >= static_cast<int>(calculated_path_.size())) {
-        CompleteTraversal();
+        HandlePathEnd();
+    }
+}
+
+bool AutomatedTraversal::BlastTile(const Position& pos) {
+    bool planned = std::find(blast_positions_.begin(), blast_positions_.end(), pos) != blast_positions_.end();
+    if (!planned || !Tile::IsBlastableType(game_map_->GetTile(pos).GetType())) {
+        return false;
     }
+
+    if (!player_character_->GetInventorySystem().UseBomb()) {
+        std::cout << "❌ No bomb left to blast (" << pos.x << ", " << pos.y << ")" << std::endl;
+        return false;
+    }
+
+    game_map_->SetTileType(pos, TileType::TRAVERSABLE_DIRT);
+    bombs_used_++;
+    std::cout << "💥 Blasted a path through (" << pos.x << ", " << pos.y << ")!" << std::endl;
+    return true;
 }
 
 void AutomatedTraversal::HandleItemPickup(const Position& pos) {
@@ -369,6 +628,7 @@ void AutomatedTraversal::ShowFinalSummary() const {
     std::cout << "  • Items found: " << total_items_found_ << std::endl;
     std::cout << "  • Items picked up: " << items_picked_up_ << std::endl;
     std::cout << "  • Items auto-equipped: " << items_equipped_ << std::endl;
+    std::cout << "  • Bombs used: " << bombs_used_ << std::endl;
 
     if (player_character_) {
         std::cout << "\n👤 PLAYER FINAL STATUS:" << std::endl;
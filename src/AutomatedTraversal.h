@@ -4,6 +4,8 @@
 #include "Pathfinding.h"
 #include "PlayerChar.h"
 #include "Map.h"
+#include "LootTourPlanner.h"
+#include "AnytimeRepairingAStar.h"
 #include <vector>
 #include <string>
 
@@ -18,7 +20,11 @@ public:
     ~AutomatedTraversal();
 
     // Main traversal methods
-    bool StartAutomatedTraversal(PlayerChar* player, Map<>* game_map, Pathfinding* pathfinder);
+    // With limits set, each search is capped; a partial path is walked and the search resumes from its end
+    bool StartAutomatedTraversal(PlayerChar* player, Map<>* game_map, Pathfinding* pathfinder,
+                                 const SearchLimits& limits = SearchLimits());
+    // Plans a detour over chests and hidden items (step_budget <= 0: twice the direct distance)
+    bool StartLootTour(PlayerChar* player, Map<>* game_map, Pathfinding* pathfinder, int step_budget = 0);
     void Update(); // Called each frame to progress movement
     void Stop(); // Stop current traversal
 
@@ -26,6 +32,8 @@ public:
     bool IsActive() const { return is_active_; }
     bool IsComplete() const { return is_complete_; }
     bool IsMoving() const { return is_moving_; }
+    bool IsPlanning() const { return is_planning_; }
+    bool IsRefiningPath() const { return is_refining_path_; }
 
     // Path visualization
     void RenderPathVisualization(int offset_x, int offset_y, int tile_size) const;
@@ -46,10 +54,14 @@ private:
     bool is_active_;
     bool is_complete_;
     bool is_moving_;
+    bool is_planning_;
+    bool is_refining_path_;
+    bool is_following_partial_path_;
     bool show_path_visualization_;
 
     // Path data
     std::vector<Position> calculated_path_;
+    std::vector<Position> blast_positions_; // Blocked tiles the path clears with bombs
     int current_step_;
     Position target_position_;
 
@@ -58,6 +70,18 @@ private:
     Map<>* game_map_;
     Pathfinding* pathfinding_system_;
 
+    // Loot tour planning (spread over frames)
+    LootTourPlanner loot_planner_;
+    long long planning_budget_ns_; // Planning time allowed per frame
+
+    // Anytime path to the destination (refined while walking)
+    AnytimeRepairingAStar anytime_planner_;
+    int path_version_; // Planner solution the current path came from
+    bool path_replanned_; // Planner restarted after a map change; its next solution replaces the path
+
+    // Capped searches (unlimited by default)
+    SearchLimits search_limits_;
+
     // Movement timing
     float movement_timer_;
     float movement_delay_; // Time between steps (in seconds)
@@ -67,10 +91,17 @@ private:
     int items_picked_up_;
     int items_equipped_;
     int total_items_found_;
+    int bombs_used_;
 
     // private methods
+    void ContinueLootTourPlanning();
+    void ContinueAnytimePlanning();
+    bool PlanLimitedPath(bool first_leg);
+    void HandlePathEnd();
+    void BeginMovement(const std::vector<Position>& path);
     void ProcessCurrentStep();
     void MoveToNextStep();
+    bool BlastTile(const Position& pos);
     void HandleItemPickup(const Position& pos);
     void HandleAutoEquipment();
     bool ShouldAutoEquipItem(const ItemBase* new_item, const ItemBase* current_item) const;
@@ -0,0 +1,173 @@
+#include "ChunkedTileGrid.h"
+#include <algorithm>
+
+// ******************** STATIC MEMBER DEFINITIONS ********************
+
+const int ChunkedTileGrid::kChunkBits;
+const int ChunkedTileGrid::kChunkSize;
+const int ChunkedTileGrid::kChunkTiles;
+const int ChunkedTileGrid::kMinResidentChunks;
+const std::size_t ChunkedTileGrid::kDefaultMemoryCap = 64 * 1024 * 1024;
+
+// ******************** CONSTRUCTOR & DESTRUCTOR ********************
+
+ChunkedTileGrid::ChunkedTileGrid()
+        : width_(0), height_(0), max_resident_chunks_(kMinResidentChunks), source_(MakeNoiseSource(0)),
+          last_chunk_(nullptr), chunk_loads_(0), chunk_evictions_(0) {
+    SetMemoryCap(kDefaultMemoryCap);
+}
+
+ChunkedTileGrid::~ChunkedTileGrid() {
+    // No dynamic cleanup needed
+}
+
+// ******************** CONFIGURATION ********************
+
+void ChunkedTileGrid::Resize(int width, int height) {
+    width_ = width;
+    height_ = height;
+    DropAllChunks();
+    saved_chunks_.clear();
+}
+
+void ChunkedTileGrid::SetChunkSource(const ChunkSource& source) {
+    source_ = source;
+    DropAllChunks();
+    saved_chunks_.clear();
+}
+
+void ChunkedTileGrid::SetMemoryCap(std::size_t max_bytes) {
+    std::size_t chunk_bytes = kChunkTiles * sizeof(Tile) + sizeof(Chunk);
+    max_resident_chunks_ = static_cast<int>(std::max<std::size_t>(kMinResidentChunks, max_bytes / chunk_bytes));
+    while (static_cast<int>(resident_chunks_.size()) > max_resident_chunks_) {
+        EvictLeastRecentlyUsed();
+    }
+}
+
+ChunkedTileGrid::ChunkSource ChunkedTileGrid::MakeNoiseSource(uint64_t seed, float blocked_ratio) {
+    uint64_t blocked_threshold = static_cast<uint64_t>(blocked_ratio * 65536.0f);
+
+    return [seed, blocked_threshold](int chunk_x, int chunk_y, std::vector<TileType>& tile_types) {
+        for (int local_y = 0; local_y < kChunkSize; ++local_y) {
+            for (int local_x = 0; local_x < kChunkSize; ++local_x) {
+                // splitmix64 of the world position, so every tile is the same whichever chunk loads first
+                uint64_t x = static_cast<uint32_t>(chunk_x * kChunkSize + local_x);
+                uint64_t y = static_cast<uint32_t>(chunk_y * kChunkSize + local_y);
+                uint64_t hash = seed ^ ((y << 32) | x);
+                hash += 0x9E3779B97F4A7C15ull;
+                hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+                hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+                hash ^= hash >> 31;
+
+                TileType type;
+                if ((hash & 0xFFFF) < blocked_threshold) {
+                    type = (hash >> 16) & 1 ? TileType::BLOCKED_TREE : TileType::BLOCKED_STONE;
+                } else {
+                    type = (hash >> 16) & 1 ? TileType::TRAVERSABLE_GRASS : TileType::TRAVERSABLE_DIRT;
+                }
+                tile_types[(local_y << kChunkBits) | local_x] = type;
+            }
+        }
+    };
+}
+
+// ******************** TILE ACCESS ********************
+
+Tile& ChunkedTileGrid::At(int x, int y) {
+    Chunk& chunk = AcquireChunk(x >> kChunkBits, y >> kChunkBits);
+    chunk.is_written = true;
+    return chunk.tiles[GetLocalIndex(x, y)];
+}
+
+const Tile& ChunkedTileGrid::At(int x, int y) const {
+    return AcquireChunk(x >> kChunkBits, y >> kChunkBits).tiles[GetLocalIndex(x, y)];
+}
+
+// ******************** CACHE STATISTICS ********************
+
+std::size_t ChunkedTileGrid::GetResidentBytes() const {
+    return resident_chunks_.size() * (kChunkTiles * sizeof(Tile) + sizeof(Chunk));
+}
+
+std::size_t ChunkedTileGrid::GetSavedChunkBytes() const {
+    return saved_chunks_.size() * kChunkTiles;
+}
+
+// ******************** CHUNK CACHE ********************
+
+ChunkedTileGrid::Chunk& ChunkedTileGrid::AcquireChunk(int chunk_x, int chunk_y) const {
+    if (last_chunk_ && last_chunk_->chunk_x == chunk_x && last_chunk_->chunk_y == chunk_y) {
+        return *last_chunk_;
+    }
+
+    auto it = resident_chunks_.find(GetChunkKey(chunk_x, chunk_y));
+    if (it == resident_chunks_.end()) {
+        last_chunk_ = &LoadChunk(chunk_x, chunk_y);
+    } else {
+        lru_order_.splice(lru_order_.begin(), lru_order_, it->second.lru_position);
+        last_chunk_ = &it->second;
+    }
+    return *last_chunk_;
+}
+
+ChunkedTileGrid::Chunk& ChunkedTileGrid::LoadChunk(int chunk_x, int chunk_y) const {
+    while (static_cast<int>(resident_chunks_.size()) >= max_resident_chunks_) {
+        EvictLeastRecentlyUsed();
+    }
+
+    uint64_t key = GetChunkKey(chunk_x, chunk_y);
+    std::vector<TileType> tile_types(kChunkTiles, TileType::BLOCKED_STONE);
+    auto saved_it = saved_chunks_.find(key);
+    if (saved_it != saved_chunks_.end()) {
+        for (int i = 0; i < kChunkTiles; ++i) {
+            tile_types[i] = static_cast<TileType>(saved_it->second[i]);
+        }
+    } else {
+        source_(chunk_x, chunk_y, tile_types);
+    }
+
+    Chunk& chunk = resident_chunks_[key];
+    chunk.chunk_x = chunk_x;
+    chunk.chunk_y = chunk_y;
+    chunk.is_written = false;
+    chunk.tiles.reserve(kChunkTiles);
+    for (int i = 0; i < kChunkTiles; ++i) {
+        chunk.tiles.emplace_back(tile_types[i], chunk_x * kChunkSize + (i & (kChunkSize - 1)),
+                                 chunk_y * kChunkSize + (i >> kChunkBits));
+    }
+    lru_order_.push_front(key);
+    chunk.lru_position = lru_order_.begin();
+
+    chunk_loads_++;
+    return chunk;
+}
+
+void ChunkedTileGrid::EvictLeastRecentlyUsed() const {
+    if (lru_order_.empty()) return;
+
+    uint64_t key = lru_order_.back();
+    auto it = resident_chunks_.find(key);
+    Chunk& chunk = it->second;
+
+    // Written chunks keep their types; untouched ones can be regenerated from the source
+    if (chunk.is_written) {
+        std::vector<uint8_t>& saved = saved_chunks_[key];
+        saved.resize(kChunkTiles);
+        for (int i = 0; i < kChunkTiles; ++i) {
+            saved[i] = static_cast<uint8_t>(chunk.tiles[i].GetType());
+        }
+    }
+
+    if (last_chunk_ == &chunk) {
+        last_chunk_ = nullptr;
+    }
+    resident_chunks_.erase(it);
+    lru_order_.pop_back();
+    chunk_evictions_++;
+}
+
+void ChunkedTileGrid::DropAllChunks() {
+    resident_chunks_.clear();
+    lru_order_.clear();
+    last_chunk_ = nullptr;
+}
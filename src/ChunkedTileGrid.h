@@ -0,0 +1,137 @@
+#ifndef RAYLIBSTARTER_CHUNKEDTILEGRID_H
+#define RAYLIBSTARTER_CHUNKEDTILEGRID_H
+
+#include "Tile.h"
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <functional>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+
+// ******************** CHUNKED TILE GRID ********************
+
+// Tiles of a world too large to allocate up front, kept as 64x64 chunks that are created on
+// first access and evicted least recently used once the memory cap is reached. A chunk's tiles
+// come from the chunk source (by default deterministic noise); chunks that were written to are
+// packed to one byte per tile on eviction and restored from that copy when they come back.
+//
+// Reads through a const grid load chunks too, so the chunk cache is mutable. A Tile reference
+// stays valid until kMinResidentChunks other chunks have been touched. Not thread safe.
+class ChunkedTileGrid {
+public:
+    static const int kChunkBits = 6;
+    static const int kChunkSize = 1 << kChunkBits;
+    static const int kChunkTiles = kChunkSize * kChunkSize;
+    static const int kMinResidentChunks = 16;
+    static const std::size_t kDefaultMemoryCap;
+
+    // Fills the kChunkTiles types of chunk (chunk_x, chunk_y), row-major inside the chunk
+    using ChunkSource = std::function<void(int chunk_x, int chunk_y, std::vector<TileType>& tile_types)>;
+
+    // Row proxy so Map can keep writing tiles[y][x]
+    template<typename Grid, typename TileValue>
+    class RowProxy {
+    public:
+        RowProxy(Grid* grid, int y) : grid_(grid), y_(y) {}
+        TileValue& operator[](int x) const { return grid_->At(x, y_); }
+
+    private:
+        Grid* grid_;
+        int y_;
+    };
+
+    // Constructor
+    ChunkedTileGrid();
+
+    // Destructor
+    ~ChunkedTileGrid();
+
+    // The cache links chunks to its own LRU list, so a grid cannot be copied
+    ChunkedTileGrid(const ChunkedTileGrid&) = delete;
+    ChunkedTileGrid& operator=(const ChunkedTileGrid&) = delete;
+
+    // Drops every chunk, including written ones; the new size only bounds chunk creation
+    void Resize(int width, int height);
+
+    // Configuration (both drop the resident chunks)
+    void SetChunkSource(const ChunkSource& source);
+    void SetMemoryCap(std::size_t max_bytes);
+    static ChunkSource MakeNoiseSource(uint64_t seed, float blocked_ratio = 0.3f);
+
+    int GetWidth() const { return width_; }
+    int GetHeight() const { return height_; }
+
+    // (x, y) access; the mutable overload marks the chunk as written
+    Tile& At(int x, int y);
+    const Tile& At(int x, int y) const;
+
+    RowProxy<ChunkedTileGrid, Tile> operator[](int y) { return RowProxy<ChunkedTileGrid, Tile>(this, y); }
+    RowProxy<const ChunkedTileGrid, const Tile> operator[](int y) const {
+        return RowProxy<const ChunkedTileGrid, const Tile>(this, y);
+    }
+
+    // Cache statistics
+    int GetResidentChunkCount() const { return static_cast<int>(resident_chunks_.size()); }
+    int GetMaxResidentChunks() const { return max_resident_chunks_; }
+    long long GetChunkLoads() const { return chunk_loads_; }
+    long long GetChunkEvictions() const { return chunk_evictions_; }
+    std::size_t GetResidentBytes() const;
+    std::size_t GetSavedChunkBytes() const;
+
+private:
+    struct Chunk {
+        int chunk_x;
+        int chunk_y;
+        bool is_written;
+        std::vector<Tile> tiles;
+        std::list<uint64_t>::iterator lru_position;
+    };
+
+    int width_;
+    int height_;
+    int max_resident_chunks_;
+    ChunkSource source_;
+
+    // Chunk cache, most recently used first
+    mutable std::unordered_map<uint64_t, Chunk> resident_chunks_;
+    mutable std::list<uint64_t> lru_order_;
+    mutable std::unordered_map<uint64_t, std::vector<uint8_t>> saved_chunks_;
+    mutable Chunk* last_chunk_;     // Skips the lookup while a search stays inside one chunk
+    mutable long long chunk_loads_;
+    mutable long long chunk_evictions_;
+
+    static uint64_t GetChunkKey(int chunk_x, int chunk_y) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(chunk_y)) << 32) | static_cast<uint32_t>(chunk_x);
+    }
+    static int GetLocalIndex(int x, int y) {
+        return ((y & (kChunkSize - 1)) << kChunkBits) | (x & (kChunkSize - 1));
+    }
+
+    Chunk& AcquireChunk(int chunk_x, int chunk_y) const;
+    Chunk& LoadChunk(int chunk_x, int chunk_y) const;
+    void EvictLeastRecentlyUsed() const;
+    void DropAllChunks();
+};
+
+inline void ResizeTileContainer(ChunkedTileGrid& tiles, int width, int height) {
+    tiles.Resize(width, height);
+}
+
+// The chunk cache is not thread safe, so a parallel pass over a chunked map is a single band
+inline int GetRowBandAlignment(const ChunkedTileGrid& tiles, int) {
+    return tiles.GetHeight() > 0 ? tiles.GetHeight() : 1;
+}
+
+// ******************** STREAMED CONTAINERS ********************
+
+// Containers that are never read whole: Map skips whole-map generation for them and the searches
+// skip per-map preprocessing
+template<typename TileContainer>
+struct IsStreamedTileContainer : std::false_type {};
+
+template<>
+struct IsStreamedTileContainer<ChunkedTileGrid> : std::true_type {};
+
+#endif //RAYLIBSTARTER_CHUNKEDTILEGRID_H
@@ -0,0 +1,41 @@
+#ifndef RAYLIBSTARTER_COUNTERRNG_H
+#define RAYLIBSTARTER_COUNTERRNG_H
+
+#include <cstdint>
+
+// ******************** COUNTER RNG ********************
+
+// Counter-based random numbers: value n of a stream is splitmix64 of (seed, stream, n), so a
+// stream needs no shared state and gives the same sequence on any thread, in any order. Map
+// generation uses one stream per row and pass, which keeps a seeded map identical however its
+// rows are split between threads.
+class CounterRng {
+public:
+    CounterRng(uint64_t seed, uint64_t stream) : key_(Mix(seed ^ Mix(stream + kGoldenGamma))), counter_(0) {}
+
+    uint64_t Next() { return Mix(key_ + ++counter_ * kGoldenGamma); }
+
+    // Uniform in [min, max], inclusive like raylib's GetRandomValue
+    int Range(int min, int max) {
+        uint64_t span = static_cast<uint64_t>(static_cast<int64_t>(max) - min + 1);
+        return static_cast<int>(min + static_cast<int64_t>(((Next() >> 32) * span) >> 32));
+    }
+
+    // Uniform in [0, 1)
+    float Uniform() { return static_cast<float>(Next() >> 40) * (1.0f / 16777216.0f); }
+
+    // splitmix64 finaliser
+    static uint64_t Mix(uint64_t value) {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
+private:
+    static const uint64_t kGoldenGamma = 0x9E3779B97F4A7C15ull;
+
+    uint64_t key_;
+    uint64_t counter_;
+};
+
+#endif //RAYLIBSTARTER_COUNTERRNG_H
@@ -0,0 +1,350 @@
+#include "DeadEndAnalysis.h"
+#include "Map.h"
+#include <iostream>
+#include <algorithm>
+
+namespace {
+    const int kDirectionX[4] = {0, 1, 0, -1};
+    const int kDirectionY[4] = {-1, 0, 1, 0};
+
+    // Renumber from scratch well before the preorder counter can wrap
+    const unsigned int kMaxOrder = 0xF0000000u;
+}
+
+// ******************** CONSTRUCTOR & DESTRUCTOR ********************
+
+DeadEndAnalysis::DeadEndAnalysis()
+        : width_(0), height_(0), map_identity_(nullptr), map_revision_(0),
+          next_order_(1), visit_epoch_(0) {
+}
+
+DeadEndAnalysis::~DeadEndAnalysis() {
+    // No dynamic cleanup needed
+}
+
+// ******************** ANALYSIS ********************
+
+template<typename TileContainer>
+void DeadEndAnalysis::Build(const Map<TileContainer>& game_map) {
+    width_ = game_map.GetWidth();
+    height_ = game_map.GetHeight();
+    size_t tile_count = static_cast<size_t>(width_) * height_;
+
+    traversable_.assign(tile_count, 0);
+    for (int y = 0; y < height_; ++y) {
+        for (int x = 0; x < width_; ++x) {
+            traversable_[GetIndex(x, y)] = game_map.GetTile(x, y).IsTraversable() ? 1 : 0;
+        }
+    }
+
+    next_order_ = 1;
+    visit_epoch_ = 0;
+    visit_epochs_.assign(tile_count, 0);
+    orders_.assign(tile_count, 0);
+    low_links_.assign(tile_count, 0);
+    subtree_ends_.assign(tile_count, 0);
+    parents_.assign(tile_count, -1);
+    separated_.assign(tile_count, 0);
+    region_begins_.assign(tile_count, 0);
+    region_ends_.assign(tile_count, 0);
+    swamps_.assign(tile_count, 0);
+
+    std::vector<int> seeds;
+    for (int index = 0; index < static_cast<int>(tile_count); ++index) {
+        if (traversable_[index]) seeds.push_back(index);
+    }
+    AnalyzeFrom(seeds);
+    UpdateSwamps(0, 0, width_ - 1, height_ - 1);
+
+    map_identity_ = &game_map;
+    map_revision_ = game_map.GetRevision();
+}
+
+template<typename TileContainer>
+void DeadEndAnalysis::Synchronize(const Map<TileContainer>& game_map) {
+    if (map_identity_ != &game_map || width_ != game_map.GetWidth() || height_ != game_map.GetHeight()) {
+        Build(game_map);
+        return;
+    }
+
+    if (map_revision_ == game_map.GetRevision()) {
+        return;
+    }
+
+    std::vector<Position> changed_tiles;
+    if (!game_map.GetTileChangesSince(map_revision_, changed_tiles) || next_order_ > kMaxOrder) {
+        Build(game_map);
+        return;
+    }
+
+    // A changed tile can split or merge only the connected areas it touches,
+    // and every tile of those areas is reachable from the tile or its neighbours
+    std::vector<int> seeds;
+    std::vector<Position> flipped_tiles;
+    for (const Position& pos : changed_tiles) {
+        int index = GetIndex(pos.x, pos.y);
+        uint8_t traversable = game_map.GetTile(pos).IsTraversable() ? 1 : 0;
+        if (traversable_[index] == traversable) continue;
+
+        traversable_[index] = traversable;
+        flipped_tiles.push_back(pos);
+        orders_[index] = 0;
+        region_begins_[index] = 0;
+        region_ends_[index] = 0;
+
+        if (traversable) seeds.push_back(index);
+        for (int direction = 0; direction < 4; ++direction) {
+            int nx = pos.x + kDirectionX[direction];
+            int ny = pos.y + kDirectionY[direction];
+            if (IsFree(nx, ny)) seeds.push_back(GetIndex(nx, ny));
+        }
+    }
+
+    AnalyzeFrom(seeds);
+
+    // Swamp status depends on the 5x5 area around a tile
+    for (const Position& pos : flipped_tiles) {
+        UpdateSwamps(pos.x - 2, pos.y - 2, pos.x + 2, pos.y + 2);
+    }
+
+    map_revision_ = game_map.GetRevision();
+}
+
+void DeadEndAnalysis::AnalyzeFrom(const std::vector<int>& seeds) {
+    if (++visit_epoch_ == 0) {
+        std::fill(visit_epochs_.begin(), visit_epochs_.end(), 0);
+        visit_epoch_ = 1;
+    }
+
+    visit_order_.clear();
+    for (int seed : seeds) {
+        if (traversable_[seed] && visit_epochs_[seed] != visit_epoch_) {
+            RunDepthFirstSearch(seed);
+        }
+    }
+
+    // Preorder pass: a tile inherits the pocket of its parent unless it starts one itself
+    for (int index : visit_order_) {
+        int parent = parents_[index];
+        if (parent < 0) {
+            region_begins_[index] = 0;
+            region_ends_[index] = 0;
+        } else if (separated_[index]) {
+            region_begins_[index] = orders_[index];
+            region_ends_[index] = subtree_ends_[index];
+        } else {
+            region_begins_[index] = region_begins_[parent];
+            region_ends_[index] = region_ends_[parent];
+        }
+    }
+}
+
+// Iterative Tarjan search; marks every subtree that only connects to the rest through its parent
+void DeadEndAnalysis::RunDepthFirstSearch(int root) {
+    search_stack_.clear();
+
+    visit_epochs_[root] = visit_epoch_;
+    orders_[root] = low_links_[root] = next_order_++;
+    parents_[root] = -1;
+    separated_[root] = 0;
+    visit_order_.push_back(root);
+    search_stack_.push_back(std::make_pair(root, 0));
+
+    while (!search_stack_.empty()) {
+        int index = search_stack_.back().first;
+        int direction = search_stack_.back().second;
+
+        if (direction < 4) {
+            search_stack_.back().second++;
+
+            int nx = index % width_ + kDirectionX[direction];
+            int ny = index / width_ + kDirectionY[direction];
+            if (!IsFree(nx, ny)) continue;
+
+            int neighbor = GetIndex(nx, ny);
+            if (visit_epochs_[neighbor] != visit_epoch_) {
+                visit_epochs_[neighbor] = visit_epoch_;
+                orders_[neighbor] = low_links_[neighbor] = next_order_++;
+                parents_[neighbor] = index;
+                separated_[neighbor] = 0;
+                visit_order_.push_back(neighbor);
+                search_stack_.push_back(std::make_pair(neighbor, 0));
+            } else if (neighbor != parents_[index]) {
+                low_links_[index] = std::min(low_links_[index], orders_[neighbor]);
+            }
+            continue;
+        }
+
+        search_stack_.pop_back();
+        subtree_ends_[index] = next_order_ - 1;
+
+        int parent = parents_[index];
+        if (parent >= 0) {
+            low_links_[parent] = std::min(low_links_[parent], low_links_[index]);
+            separated_[index] = (low_links_[index] >= orders_[parent]) ? 1 : 0;
+        }
+    }
+}
+
+// ******************** SWAMPS ********************
+
+// A tip, or an L-bend whose diagonal tile joins the same two neighbours at the same cost
+bool DeadEndAnalysis::IsSwampCandidate(int x, int y) const {
+    if (!IsFree(x, y)) {
+        return false;
+    }
+
+    int free_count = 0;
+    int free_directions[4];
+    for (int direction = 0; direction < 4; ++direction) {
+        if (IsFree(x + kDirectionX[direction], y + kDirectionY[direction])) {
+            free_directions[free_count++] = direction;
+        }
+    }
+
+    if (free_count <= 1) {
+        return true;
+    }
+    if (free_count != 2 || (free_directions[0] + 2) % 4 == free_directions[1]) {
+        return false; // Straight corridors and junctions are needed
+    }
+
+    int diagonal_x = x + kDirectionX[free_directions[0]] + kDirectionX[free_directions[1]];
+    int diagonal_y = y + kDirectionY[free_directions[0]] + kDirectionY[free_directions[1]];
+    return IsFree(diagonal_x, diagonal_y);
+}
+
+// A candidate becomes a swamp only if no earlier candidate sits in its 3x3 area
+void DeadEndAnalysis::UpdateSwamps(int min_x, int min_y, int max_x, int max_y) {
+    min_x = std::max(0, min_x);
+    min_y = std::max(0, min_y);
+    max_x = std::min(width_ - 1, max_x);
+    max_y = std::min(height_ - 1, max_y);
+
+    for (int y = min_y; y <= max_y; ++y) {
+        for (int x = min_x; x <= max_x; ++x) {
+            bool is_swamp = IsSwampCandidate(x, y);
+            for (int dy = -1; dy <= 1 && is_swamp; ++dy) {
+                for (int dx = -1; dx <= 1 && is_swamp; ++dx) {
+                    bool earlier = dy < 0 || (dy == 0 && dx < 0);
+                    if (earlier && IsSwampCandidate(x + dx, y + dy)) {
+                        is_swamp = false;
+                    }
+                }
+            }
+            swamps_[GetIndex(x, y)] = is_swamp ? 1 : 0;
+        }
+    }
+}
+
+// ******************** QUERY ********************
+
+DeadEndQuery DeadEndAnalysis::MakeQuery(const Position& start, const Position& goal) const {
+    DeadEndQuery query;
+    if (IsFree(start.x, start.y)) {
+        query.start_index = GetIndex(start.x, start.y);
+        query.start_order = orders_[query.start_index];
+    }
+    if (IsFree(goal.x, goal.y)) {
+        query.goal_index = GetIndex(goal.x, goal.y);
+        query.goal_order = orders_[query.goal_index];
+    }
+    return query;
+}
+
+bool DeadEndAnalysis::IsPruned(const Position& pos, const DeadEndQuery& query) const {
+    int index = GetIndex(pos.x, pos.y);
+    if (index == query.start_index || index == query.goal_index) {
+        return false;
+    }
+    if (swamps_[index]) {
+        return true;
+    }
+
+    unsigned int begin = region_begins_[index];
+    if (begin == 0) {
+        return false;
+    }
+    unsigned int end = region_ends_[index];
+    bool holds_start = query.start_order >= begin && query.start_order <= end;
+    bool holds_goal = query.goal_order >= begin && query.goal_order <= end;
+    return !holds_start && !holds_goal;
+}
+
+// ******************** ANALYSIS INFO ********************
+
+int DeadEndAnalysis::GetDeadEndTileCount() const {
+    return static_cast<int>(std::count_if(region_begins_.begin(), region_begins_.end(),
+                                          [](unsigned int begin) { return begin != 0; }));
+}
+
+int DeadEndAnalysis::GetSwampTileCount() const {
+    return static_cast<int>(std::count(swamps_.begin(), swamps_.end(), 1));
+}
+
+void DeadEndAnalysis::PrintAnalysisInfo() const {
+    std::cout << "Dead-end analysis: " << GetDeadEndTileCount() << " tiles in dead-end pockets, "
+              << GetSwampTileCount() << " swamp tiles" << std::endl;
+}
+
+// ******************** PRIVATE HELPER METHODS ********************
+
+bool DeadEndAnalysis::IsFree(int x, int y) const {
+    return x >= 0 && x < width_ && y >= 0 && y < height_ && traversable_[GetIndex(x, y)] != 0;
+}
+
+// ******************** EXPLICIT TEMPLATE INSTANTIATIONS ********************
+
+template void DeadEndAnalysis::Build<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map);
+
+template void DeadEndAnalysis::Synchronize<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map);
+
+// Flat row-major grid (the default Map<> container)
+
+template void DeadEndAnalysis::Build<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map);
+
+template void DeadEndAnalysis::Synchronize<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map);
+
+// Morton-ordered 8x8 blocks
+
+template void DeadEndAnalysis::Build<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map);
+
+template void DeadEndAnalysis::Synchronize<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map);
+
+// Type byte plus bit planes
+
+template void DeadEndAnalysis::Build<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map);
+
+template void DeadEndAnalysis::Synchronize<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map);
+
+// Build-time 64x64 grid
+
+template void DeadEndAnalysis::Build<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map);
+
+template void DeadEndAnalysis::Synchronize<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map);
+
+// Streamed 64x64 chunks
+
+template void DeadEndAnalysis::Build<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map);
+
+template void DeadEndAnalysis::Synchronize<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map);
+
+// Memory-mapped map file
+
+template void DeadEndAnalysis::Build<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map);
+
+template void DeadEndAnalysis::Synchronize<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map);
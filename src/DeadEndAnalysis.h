@@ -0,0 +1,90 @@
+#ifndef RAYLIBSTARTER_DEADENDANALYSIS_H
+#define RAYLIBSTARTER_DEADENDANALYSIS_H
+
+#include "Tile.h"
+#include <vector>
+#include <cstdint>
+
+// Forward declaration
+template<typename TileContainer> class Map;
+
+// ******************** PRUNING QUERY STRUCTURE ********************
+
+// Per-query data for IsPruned, built once by MakeQuery
+struct DeadEndQuery {
+    int start_index;
+    int goal_index;
+    unsigned int start_order;
+    unsigned int goal_order;
+
+    DeadEndQuery() : start_index(-1), goal_index(-1), start_order(0), goal_order(0) {}
+};
+
+// ******************** DEAD-END AND SWAMP ANALYSIS ********************
+
+// Dead ends: a depth-first search over the traversable tiles finds every subtree that is
+// attached to the rest of the map through a single tile (a cut vertex). A shortest path
+// never enters such a pocket unless the start or goal lies inside it.
+// Swamps: L-bends and tips whose neighbours can bypass them at the same cost. No two swamp
+// tiles are neighbours (diagonals included), so every swamp can be skipped on its own.
+class DeadEndAnalysis {
+public:
+    // Constructor
+    DeadEndAnalysis();
+
+    // Destructor
+    ~DeadEndAnalysis();
+
+    // Full analysis
+    template<typename TileContainer>
+    void Build(const Map<TileContainer>& game_map);
+
+    // Brings the analysis up to date, recomputing only the connected areas around changed tiles
+    template<typename TileContainer>
+    void Synchronize(const Map<TileContainer>& game_map);
+
+    // Query
+    DeadEndQuery MakeQuery(const Position& start, const Position& goal) const;
+    bool IsPruned(const Position& pos, const DeadEndQuery& query) const;
+
+    // Analysis info
+    int GetDeadEndTileCount() const;
+    int GetSwampTileCount() const;
+    void PrintAnalysisInfo() const;
+
+private:
+    // Map snapshot
+    int width_;
+    int height_;
+    std::vector<uint8_t> traversable_;
+    const void* map_identity_;
+    unsigned long long map_revision_;
+
+    // Depth-first search numbering (0 = not numbered); numbers are never reused
+    // between incremental updates, so intervals stay unique across components
+    unsigned int next_order_;
+    unsigned int visit_epoch_;
+    std::vector<unsigned int> visit_epochs_;
+    std::vector<unsigned int> orders_;
+    std::vector<unsigned int> low_links_;
+    std::vector<unsigned int> subtree_ends_;
+    std::vector<int> parents_;
+    std::vector<uint8_t> separated_;
+    std::vector<std::pair<int, int>> search_stack_;   // Tile index, next direction
+    std::vector<int> visit_order_;
+
+    // Results: innermost dead-end pocket per tile as a preorder interval (begin 0 = none)
+    std::vector<unsigned int> region_begins_;
+    std::vector<unsigned int> region_ends_;
+    std::vector<uint8_t> swamps_;
+
+    // Helpers
+    bool IsFree(int x, int y) const;
+    int GetIndex(int x, int y) const { return y * width_ + x; }
+    void AnalyzeFrom(const std::vector<int>& seeds);
+    void RunDepthFirstSearch(int root);
+    bool IsSwampCandidate(int x, int y) const;
+    void UpdateSwamps(int min_x, int min_y, int max_x, int max_y);
+};
+
+#endif //RAYLIBSTARTER_DEADENDANALYSIS_H
@@ -0,0 +1,78 @@
+#ifndef RAYLIBSTARTER_FIXEDGRID_H
+#define RAYLIBSTARTER_FIXEDGRID_H
+
+#include "Tile.h"
+#include "FlatTileGrid.h"
+#include <array>
+#include <cstddef>
+
+// ******************** FIXED GRID ********************
+
+// Row-major tiles in a std::array for maps whose size is known at build time. Width, height,
+// stride and neighbour offsets are constants, so Map<FixedGrid<W, H>> folds its bounds checks
+// and index math, and A* runs on a FixedSearchWorkspace. The tiles live inside the Map object:
+// keep large grids off the stack.
+template<int Width, int Height>
+class FixedGrid {
+public:
+    static_assert(Width > 0 && Height > 0, "FixedGrid needs a positive size");
+
+    static constexpr int kWidth = Width;
+    static constexpr int kHeight = Height;
+    static constexpr int kStride = Width;
+    static constexpr std::size_t kTileCount = static_cast<std::size_t>(Width) * Height;
+
+    // Index offsets of the up, right, down and left neighbours (FourWayMovement order)
+    static constexpr int kNeighborOffsets[4] = {-kStride, 1, kStride, -1};
+
+    // Every tile is reset to a default Tile; the size is fixed, so the arguments must match it
+    void Resize(int width, int height) {
+        (void)width;
+        (void)height;
+        tiles_.fill(Tile());
+    }
+
+    static constexpr int GetWidth() { return kWidth; }
+    static constexpr int GetHeight() { return kHeight; }
+
+    // (x, y) access
+    Tile& At(int x, int y) { return tiles_[GetIndex(x, y)]; }
+    const Tile& At(int x, int y) const { return tiles_[GetIndex(x, y)]; }
+
+    // Row access
+    TileRowSpan operator[](int y) { return TileRowSpan(tiles_.data() + GetIndex(0, y), kWidth); }
+    ConstTileRowSpan operator[](int y) const { return ConstTileRowSpan(tiles_.data() + GetIndex(0, y), kWidth); }
+
+    // Whole grid, row-major
+    Tile* Data() { return tiles_.data(); }
+    const Tile* Data() const { return tiles_.data(); }
+    static constexpr std::size_t GetTileCount() { return kTileCount; }
+
+    static constexpr std::size_t GetIndex(int x, int y) { return static_cast<std::size_t>(y) * kStride + x; }
+    static constexpr bool Contains(int x, int y) { return x >= 0 && x < kWidth && y >= 0 && y < kHeight; }
+
+private:
+    std::array<Tile, kTileCount> tiles_;
+};
+
+template<int Width, int Height>
+inline void ResizeTileContainer(FixedGrid<Width, Height>& tiles, int width, int height) {
+    tiles.Resize(width, height);
+}
+
+// ******************** CONTAINER EXTENT ********************
+
+// Compile-time size of a tile container, 0 when it is sized at runtime
+template<typename TileContainer>
+struct TileContainerExtent {
+    static constexpr int kWidth = 0;
+    static constexpr int kHeight = 0;
+};
+
+template<int Width, int Height>
+struct TileContainerExtent<FixedGrid<Width, Height>> {
+    static constexpr int kWidth = Width;
+    static constexpr int kHeight = Height;
+};
+
+#endif //RAYLIBSTARTER_FIXEDGRID_H
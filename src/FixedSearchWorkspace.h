@@ -0,0 +1,137 @@
+#ifndef RAYLIBSTARTER_FIXEDSEARCHWORKSPACE_H
+#define RAYLIBSTARTER_FIXEDSEARCHWORKSPACE_H
+
+#include "FixedGrid.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// ******************** FIXED SEARCH WORKSPACE ********************
+
+// A* state for Map<FixedGrid<W, H>> in std::arrays sized at build time: costs, parents and an
+// indexed binary heap that holds every open tile once, so a query allocates nothing and the
+// workspace lives on the stack. Tiles are FixedGrid indices, neighbours FixedGrid::kNeighborOffsets.
+template<int Width, int Height>
+class FixedSearchWorkspace {
+public:
+    using Grid = FixedGrid<Width, Height>;
+
+    static constexpr int kTileCount = static_cast<int>(Grid::kTileCount);
+    static constexpr int kNoTile = -1;
+
+    // Largest grid searched with a workspace on the stack (about 21 bytes per tile)
+    static constexpr std::size_t kMaxStackTiles = std::size_t(1) << 14;
+    static constexpr bool kFitsOnStack = Grid::kTileCount <= kMaxStackTiles;
+
+    FixedSearchWorkspace() : open_count_(0) {}
+
+    // Forgets every tile
+    void BeginSearch() {
+        states_.fill(TileState::UNSEEN);
+        open_count_ = 0;
+    }
+
+    // Tile state for the current search
+    bool IsSeen(int tile) const { return states_[tile] != TileState::UNSEEN; }
+    bool IsClosed(int tile) const { return states_[tile] == TileState::CLOSED; }
+    float GetCost(int tile) const { return g_costs_[tile]; }
+    int GetParent(int tile) const { return parents_[tile]; }
+
+    // Records a cheaper path into tile and (re)opens it; returns true if the tile had been expanded
+    bool Relax(int tile, float g_cost, float f_cost, int parent) {
+        bool was_closed = states_[tile] == TileState::CLOSED;
+        g_costs_[tile] = g_cost;
+        f_costs_[tile] = f_cost;
+        parents_[tile] = parent;
+        if (states_[tile] == TileState::OPEN) {
+            SiftUp(heap_index_[tile]); // The f cost only drops
+        } else {
+            states_[tile] = TileState::OPEN;
+            heap_[open_count_] = tile;
+            heap_index_[tile] = open_count_;
+            SiftUp(open_count_++);
+        }
+        return was_closed;
+    }
+
+    // Open tile with the lowest f cost, which becomes closed
+    int PopOpen() {
+        int tile = heap_[0];
+        states_[tile] = TileState::CLOSED;
+        if (--open_count_ > 0) {
+            heap_[0] = heap_[open_count_];
+            heap_index_[heap_[0]] = 0;
+            SiftDown(0);
+        }
+        return tile;
+    }
+
+    bool HasOpen() const { return open_count_ > 0; }
+    int GetOpenCount() const { return open_count_; }
+
+    // Neighbour of tile in FourWayMovement order (up, right, down, left), kNoTile off the grid
+    static int GetNeighbor(int tile, int direction) {
+        int x = tile % Grid::kStride;
+        int y = tile / Grid::kStride;
+        bool inside = direction == 0 ? y > 0
+                    : direction == 1 ? x < Grid::kWidth - 1
+                    : direction == 2 ? y < Grid::kHeight - 1
+                    : x > 0;
+        return inside ? tile + Grid::kNeighborOffsets[direction] : kNoTile;
+    }
+
+    static constexpr std::size_t GetBytesAllocated() { return sizeof(FixedSearchWorkspace); }
+
+private:
+    enum class TileState : uint8_t {
+        UNSEEN,
+        OPEN,
+        CLOSED
+    };
+
+    std::array<float, kTileCount> g_costs_;
+    std::array<float, kTileCount> f_costs_;
+    std::array<int, kTileCount> parents_;
+    std::array<int, kTileCount> heap_;        // Open tiles, a binary min-heap on f cost
+    std::array<int, kTileCount> heap_index_;  // Position of each open tile in heap_
+    std::array<TileState, kTileCount> states_;
+    int open_count_;
+
+    void SiftUp(int slot) {
+        int tile = heap_[slot];
+        while (slot > 0) {
+            int parent_slot = (slot - 1) / 2;
+            if (f_costs_[heap_[parent_slot]] <= f_costs_[tile]) {
+                break;
+            }
+            heap_[slot] = heap_[parent_slot];
+            heap_index_[heap_[slot]] = slot;
+            slot = parent_slot;
+        }
+        heap_[slot] = tile;
+        heap_index_[tile] = slot;
+    }
+
+    void SiftDown(int slot) {
+        int tile = heap_[slot];
+        for (;;) {
+            int child = 2 * slot + 1;
+            if (child >= open_count_) {
+                break;
+            }
+            if (child + 1 < open_count_ && f_costs_[heap_[child + 1]] < f_costs_[heap_[child]]) {
+                child++;
+            }
+            if (f_costs_[tile] <= f_costs_[heap_[child]]) {
+                break;
+            }
+            heap_[slot] = heap_[child];
+            heap_index_[heap_[slot]] = slot;
+            slot = child;
+        }
+        heap_[slot] = tile;
+        heap_index_[tile] = slot;
+    }
+};
+
+#endif //RAYLIBSTARTER_FIXEDSEARCHWORKSPACE_H
@@ -0,0 +1,82 @@
+#ifndef RAYLIBSTARTER_FLATTILEGRID_H
+#define RAYLIBSTARTER_FLATTILEGRID_H
+
+#include "Tile.h"
+#include <vector>
+#include <cstddef>
+
+// ******************** TILE ROW SPAN ********************
+
+// One row of a flat grid; tiles[y][x] reads the same as with nested vectors
+template<typename TileValue>
+class BasicTileRowSpan {
+public:
+    BasicTileRowSpan(TileValue* first, int length) : first_(first), length_(length) {}
+
+    TileValue& operator[](int x) const { return first_[x]; }
+    TileValue* begin() const { return first_; }
+    TileValue* end() const { return first_ + length_; }
+    int size() const { return length_; }
+
+private:
+    TileValue* first_;
+    int length_;
+};
+
+using TileRowSpan = BasicTileRowSpan<Tile>;
+using ConstTileRowSpan = BasicTileRowSpan<const Tile>;
+
+// ******************** FLAT TILE GRID ********************
+
+// Row-major tile storage in one allocation, the default Map<> container. Row y starts at
+// y * width, so scans walk memory in order and a search touches no per-row heap blocks.
+class FlatTileGrid {
+public:
+    FlatTileGrid() : width_(0), height_(0) {}
+
+    // Every tile is reset to a default Tile
+    void Resize(int width, int height) {
+        width_ = width;
+        height_ = height;
+        tiles_.assign(static_cast<std::size_t>(width) * height, Tile());
+    }
+
+    int GetWidth() const { return width_; }
+    int GetHeight() const { return height_; }
+
+    // (x, y) access
+    Tile& At(int x, int y) { return tiles_[GetIndex(x, y)]; }
+    const Tile& At(int x, int y) const { return tiles_[GetIndex(x, y)]; }
+
+    // Row access
+    TileRowSpan operator[](int y) { return TileRowSpan(tiles_.data() + GetIndex(0, y), width_); }
+    ConstTileRowSpan operator[](int y) const { return ConstTileRowSpan(tiles_.data() + GetIndex(0, y), width_); }
+
+    // Whole grid, row-major
+    Tile* Data() { return tiles_.data(); }
+    const Tile* Data() const { return tiles_.data(); }
+    std::size_t GetTileCount() const { return tiles_.size(); }
+
+    std::size_t GetIndex(int x, int y) const { return static_cast<std::size_t>(y) * width_ + x; }
+
+private:
+    int width_;
+    int height_;
+    std::vector<Tile> tiles_;
+};
+
+// ******************** CONTAINER SIZING ********************
+
+// Map sizes its container through these overloads, one per supported layout
+inline void ResizeTileContainer(std::vector<std::vector<Tile>>& tiles, int width, int height) {
+    tiles.resize(height);
+    for (std::vector<Tile>& row : tiles) {
+        row.resize(width);
+    }
+}
+
+inline void ResizeTileContainer(FlatTileGrid& tiles, int width, int height) {
+    tiles.Resize(width, height);
+}
+
+#endif //RAYLIBSTARTER_FLATTILEGRID_H
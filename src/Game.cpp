@@ -7,6 +7,9 @@
 // ******************** STATIC CONSTANTS ********************
 
 const char* Game::kProjectName = "2D Map Generator - Task 1c";
+const int Game::kTraversalSearchExpansions;
+const int Game::kMovementRange;
+const char* Game::kMapFilePath = "world.kmap";
 
 // ******************** CONSTRUCTOR & DESTRUCTOR ********************
 
@@ -15,6 +18,8 @@ Game::Game()
         , should_close_(false)
         , game_map_(nullptr)
         , inventory_system_(nullptr)
+        , show_movement_range_(false)
+        , movement_range_revision_(0)
         , render_scale_(1.0f)
         , tile_size_(30) {
     // Constructor initialization
@@ -160,6 +165,10 @@ void Game::HandleInput() {
                     pathfinding_system_->CompareAlgorithms(*game_map_);
                 }
             }
+            if (IsKeyPressed(KEY_H)) {
+                // Dump per-algorithm search histograms
+                SearchStatsAggregator::PrintReport();
+            }
             if (IsKeyPressed(KEY_ZERO)) {
                 if (pathfinding_system_ && game_map_ && player_character_) {
                     std::cout << "\n🎯 Finding path from player to end..." << std::endl;
@@ -192,6 +201,27 @@ void Game::HandleInput() {
                     }
                 }
             }
+            if (IsKeyPressed(KEY_B) && !automated_traversal_->IsActive()) {
+                if (automated_traversal_ && pathfinding_system_ && game_map_ && player_character_) {
+                    // Capped searches: walk partial paths and search again from their end
+                    std::cout << "\n🤖 Starting budgeted traversal (" << kTraversalSearchExpansions
+                              << " expansions per search)..." << std::endl;
+                    if (!automated_traversal_->StartAutomatedTraversal(
+                            player_character_.get(), game_map_.get(), pathfinding_system_.get(),
+                            SearchLimits(kTraversalSearchExpansions))) {
+                        std::cout << "❌ Could not start budgeted traversal." << std::endl;
+                    }
+                }
+            }
+            if (IsKeyPressed(KEY_L) && !automated_traversal_->IsActive()) {
+                if (automated_traversal_ && pathfinding_system_ && game_map_ && player_character_) {
+                    std::cout << "\n🤖 Starting loot tour to end position..." << std::endl;
+                    if (!automated_traversal_->StartLootTour(
+                            player_character_.get(), game_map_.get(), pathfinding_system_.get())) {
+                        std::cout << "❌ Could not start loot tour." << std::endl;
+                    }
+                }
+            }
             if (IsKeyPressed(KEY_S) && automated_traversal_->IsActive()) {
                 // Stop automated traversal
                 std::cout << "\n🛑 Stopping automated traversal..." << std::endl;
@@ -205,6 +235,23 @@ void Game::HandleInput() {
                               (automated_traversal_->IsPathVisualizationEnabled() ? "ON" : "OFF") << std::endl;
                 }
             }
+            if (IsKeyPressed(KEY_K) && pathfinding_system_) {
+                // Toggle weighted terrain: grass is slow, dirt a little slow, stone tiles stay at 1
+                if (pathfinding_system_->HasUniformTerrainCosts()) {
+                    pathfinding_system_->SetTerrainCost(TileType::TRAVERSABLE_GRASS, 3.0f);
+                    pathfinding_system_->SetTerrainCost(TileType::TRAVERSABLE_DIRT, 1.5f);
+                } else {
+                    pathfinding_system_->ResetTerrainCosts();
+                }
+                pathfinding_system_->PrintTerrainCosts();
+            }
+            if (IsKeyPressed(KEY_G)) {
+                // Toggle the movement-range overlay
+                show_movement_range_ = !show_movement_range_;
+                movement_range_ = ReachableSet();
+                std::cout << "Movement range (" << kMovementRange << " steps): "
+                          << (show_movement_range_ ? "ON" : "OFF") << std::endl;
+            }
             if (IsKeyPressed(KEY_M) && automated_traversal_->IsComplete()) {
                 // Show final summary again
                 if (automated_traversal_) {
@@ -269,6 +316,23 @@ void Game::HandleInput() {
                 }
                 std::cout << "Map regenerated with terrain clustering and items!" << std::endl;
             }
+            if (IsKeyPressed(KEY_F5)) {
+                // Save map, tiles and remaining items
+                if (game_map_->SaveMapFile(kMapFilePath)) {
+                    std::cout << "Map saved to " << kMapFilePath << std::endl;
+                }
+            }
+            if (IsKeyPressed(KEY_F9)) {
+                // Load the saved map and respawn player at its start position
+                if (game_map_->LoadMapFile(kMapFilePath)) {
+                    if (player_character_) {
+                        Position new_start = game_map_->GetStartPosition();
+                        player_character_->SetPosition(new_start);
+                        std::cout << "Player respawned at: (" << new_start.x << ", " << new_start.y << ")" << std::endl;
+                    }
+                    std::cout << "Map loaded from " << kMapFilePath << std::endl;
+                }
+            }
             if (IsKeyPressed(KEY_C)) {
                 // Print map to console
                 std::cout << "\n=== CURRENT MAP ===" << std::endl;
@@ -467,6 +531,10 @@ void Game::RenderGame() {
                 // Render the map
                 game_map_->Render(offset_x, offset_y, tile_size_);
 
+                if (show_movement_range_) {
+                    RenderMovementRange(offset_x, offset_y);
+                }
+
                 // Render player character
                 if (player_character_) {
                     Position player_pos = player_character_->GetPosition();
@@ -565,6 +633,30 @@ void Game::RenderGame() {
     }
 }
 
+void Game::RenderMovementRange(int offset_x, int offset_y) {
+    if (!player_character_ || !pathfinding_system_) {
+        return;
+    }
+
+    Position player_pos = player_character_->GetPosition();
+    if (movement_range_.tiles.empty() || movement_range_.origin != player_pos ||
+        movement_range_revision_ != game_map_->GetRevision()) {
+        bool was_verbose = pathfinding_system_->IsVerbose();
+        pathfinding_system_->SetVerbose(false);
+        movement_range_ = pathfinding_system_->ReachableWithin(player_pos, kMovementRange, *game_map_);
+        pathfinding_system_->SetVerbose(was_verbose);
+        movement_range_revision_ = game_map_->GetRevision();
+    }
+
+    // Farther tiles fade out
+    for (size_t i = 0; i < movement_range_.tiles.size(); ++i) {
+        const Position& tile = movement_range_.tiles[i];
+        float alpha = 0.45f - 0.3f * movement_range_.costs[i] / (kMovementRange + 1);
+        DrawRectangle(offset_x + tile.x * tile_size_, offset_y + tile.y * tile_size_,
+                      tile_size_, tile_size_, ColorAlpha(SKYBLUE, alpha));
+    }
+}
+
 void Game::RenderUI() {
     // Render UI elements that appear outside the canvas
     if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyDown(KEY_S)) {
@@ -577,7 +669,7 @@ void Game::RenderUI() {
             DrawText("AUTOMATED MODE: S=Stop | V=ToggleViz | M=Summary | I=Inventory | 1-4=Sort",
                      10, GetScreenHeight() - 30, 8, YELLOW);
         } else {
-            DrawText("Controls: WASD=Move | F=Pick | A=AutoTraversal | I=Inventory | 8=Pathfind | 1-4=Sort | 6=TestItems | 7=Demo",
+            DrawText("Controls: WASD=Move | F=Pick | A=AutoTraversal | B=Budgeted | L=LootTour | G=Range | K=Terrain | I=Inventory | 8=Pathfind | H=SearchStats | 1-4=Sort | 6=TestItems | 7=Demo | F5/F9=Save/Load",
                      10, GetScreenHeight() - 30, 7, DARKGRAY);
         }
 
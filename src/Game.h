@@ -31,6 +31,15 @@ public:
     static const int kScreenHeight = 600;
     static const char* kProjectName;
 
+    // Expansion cap per search of the budgeted traversal
+    static const int kTraversalSearchExpansions = 2000;
+
+    // Steps shown by the movement-range overlay
+    static const int kMovementRange = 6;
+
+    // Map file written by F5 and read back by F9
+    static const char* kMapFilePath;
+
     // Constructor & Destructor
     Game();
     ~Game();
@@ -75,6 +84,10 @@ private:
     // Automated Traversal system
     std::unique_ptr<AutomatedTraversal> automated_traversal_;
 
+    // Movement-range overlay, recomputed when the player moves or the map changes
+    bool show_movement_range_;
+    ReachableSet movement_range_;
+    unsigned long long movement_range_revision_;
 
     // Rendering properties
     RenderTexture2D canvas_;
@@ -90,6 +103,7 @@ private:
     void CalculateRenderScale();
     void RenderGame();
     void RenderUI();
+    void RenderMovementRange(int offset_x, int offset_y);
     void CleanupResources();
 
     // Inventory integration methods
@@ -0,0 +1,546 @@
+#include "LootTourPlanner.h"
+#include "Map.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <limits>
+
+namespace {
+    const int kDirectionX[4] = {0, 1, 0, -1};
+    const int kDirectionY[4] = {-1, 0, 1, 0};
+}
+
+// ******************** CONSTRUCTOR & DESTRUCTOR ********************
+
+LootTourPlanner::LootTourPlanner()
+        : phase_(Phase::IDLE), start_(0, 0), end_(0, 0), step_budget_(0), carry_capacity_(0.0f),
+          next_source_(0), next_leg_(0), planning_time_ns_(0), used_exact_solver_(false) {
+}
+
+LootTourPlanner::~LootTourPlanner() {
+    // No dynamic cleanup needed
+}
+
+// ******************** PLANNING ********************
+
+template<typename TileContainer>
+void LootTourPlanner::Begin(const Map<TileContainer>& game_map, const Position& start, const Position& end,
+                            int step_budget, float carry_capacity) {
+    Reset();
+    start_ = start;
+    end_ = end;
+    step_budget_ = step_budget;
+    carry_capacity_ = carry_capacity;
+
+    if (!game_map.IsValidPosition(start) || !game_map.IsValidPosition(end) ||
+        !game_map.GetTile(start).IsTraversable() || !game_map.GetTile(end).IsTraversable()) {
+        std::cout << "Loot tour: start or end is not traversable!" << std::endl;
+        phase_ = Phase::DONE;
+        return;
+    }
+
+    // Group collectable items by tile (workspace indices); items on start or end are collected anyway
+    workspace_.BeginSearch(game_map.GetWidth(), game_map.GetHeight(), IsStreamedTileContainer<TileContainer>::value);
+    std::unordered_map<int64_t, int> stop_at_tile;
+    for (const auto& item_with_pos : game_map.GetItemManager().GetAllItems()) {
+        const Position& pos = item_with_pos.position;
+        if (!game_map.IsValidPosition(pos) || pos == start || pos == end) continue;
+
+        const Tile& tile = game_map.GetTile(pos);
+        if (!tile.IsTraversable()) continue;
+        if (item_with_pos.is_in_treasure_chest && !tile.IsClosedTreasureChest()) continue;
+
+        auto inserted = stop_at_tile.emplace(workspace_.GetIndex(pos), static_cast<int>(stops_.size()));
+        if (inserted.second) {
+            stops_.emplace_back(pos);
+        }
+        LootTourStop& stop = stops_[inserted.first->second];
+        stop.value += item_with_pos.item->GetValue();
+        stop.weight += item_with_pos.item->GetWeight();
+        stop.item_count++;
+    }
+
+    // Search targets: every stop and the end (the start is only ever a source)
+    for (int i = 0; i < static_cast<int>(stops_.size()); ++i) {
+        node_at_tile_[workspace_.GetIndex(stops_[i].position)] = i + 1;
+    }
+    node_at_tile_[workspace_.GetIndex(end)] = GetEndNode();
+
+    int node_count = GetNodeCount();
+    distances_.assign(static_cast<size_t>(node_count) * node_count, -1);
+    for (int node = 0; node < node_count; ++node) {
+        distances_[node * node_count + node] = 0;
+    }
+
+    next_source_ = 0;
+    phase_ = Phase::DISTANCES;
+}
+
+template<typename TileContainer>
+bool LootTourPlanner::Continue(const Map<TileContainer>& game_map, long long time_budget_ns) {
+    auto slice_start = std::chrono::steady_clock::now();
+    auto deadline = slice_start + std::chrono::nanoseconds(time_budget_ns);
+
+    while (phase_ != Phase::DONE && phase_ != Phase::IDLE) {
+        switch (phase_) {
+            case Phase::DISTANCES:
+                // One one-to-all search per slice; the end never needs to be a source
+                if (next_source_ < GetEndNode()) {
+                    RunDistanceSearch(game_map, next_source_++);
+                } else {
+                    FinishDistances();
+                }
+                break;
+
+            case Phase::SOLVING:
+                Solve(deadline);
+                break;
+
+            case Phase::PATHS:
+                if (next_leg_ <= static_cast<int>(tour_.size())) {
+                    int from_node = (next_leg_ == 0) ? 0 : tour_[next_leg_ - 1];
+                    int to_node = (next_leg_ == static_cast<int>(tour_.size())) ? GetEndNode() : tour_[next_leg_];
+                    AppendLeg(game_map, GetNodePosition(from_node), GetNodePosition(to_node));
+                    next_leg_++;
+                } else {
+                    phase_ = Phase::DONE;
+                }
+                break;
+
+            default:
+                break;
+        }
+
+        if (std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+    }
+
+    planning_time_ns_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - slice_start).count();
+    return phase_ == Phase::DONE;
+}
+
+void LootTourPlanner::Reset() {
+    phase_ = Phase::IDLE;
+    stops_.clear();
+    node_at_tile_.clear();
+    distances_.clear();
+    tour_.clear();
+    path_.clear();
+    next_source_ = 0;
+    next_leg_ = 0;
+    planning_time_ns_ = 0;
+    used_exact_solver_ = false;
+}
+
+// ******************** DISTANCE MATRIX ********************
+
+template<typename TileContainer>
+void LootTourPlanner::RunDistanceSearch(const Map<TileContainer>& game_map, int source_node) {
+    int node_count = GetNodeCount();
+
+    // Distances are symmetric, so rows of earlier sources already cover lower node ids
+    int remaining = node_count - 1 - source_node;
+    if (remaining <= 0) {
+        return;
+    }
+
+    int width = game_map.GetWidth();
+    int height = game_map.GetHeight();
+    workspace_.BeginSearch(width, height, IsStreamedTileContainer<TileContainer>::value);
+    std::vector<int64_t>& frontier = workspace_.GetFrontier();
+
+    // Node tiles are marked so most tiles skip the node lookup
+    for (const auto& node_tile : node_at_tile_) {
+        workspace_.MarkTarget(node_tile.first);
+    }
+
+    Position source = GetNodePosition(source_node);
+    int64_t source_index = workspace_.GetIndex(source);
+    workspace_.Visit(source_index, 0, -1);
+    frontier.push_back(source_index);
+
+    for (size_t head = 0; head < frontier.size() && remaining > 0; ++head) {
+        int64_t index = frontier[head];
+        int distance = workspace_.GetDistance(index);
+
+        int node = workspace_.IsTarget(index) ? node_at_tile_.at(index) : -1;
+        if (node > source_node) {
+            distances_[source_node * node_count + node] = distance;
+            distances_[node * node_count + source_node] = distance;
+            remaining--;
+        }
+
+        Position current = workspace_.GetPosition(index);
+        for (int direction = 0; direction < 4; ++direction) {
+            int nx = current.x + kDirectionX[direction];
+            int ny = current.y + kDirectionY[direction];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+
+            int64_t neighbor = workspace_.GetIndex(nx, ny);
+            if (workspace_.IsVisited(neighbor) || !game_map.GetTile(nx, ny).IsTraversable()) continue;
+
+            workspace_.Visit(neighbor, distance + 1, index);
+            frontier.push_back(neighbor);
+        }
+    }
+}
+
+void LootTourPlanner::FinishDistances() {
+    int direct_distance = GetDistance(0, GetEndNode());
+    if (direct_distance < 0) {
+        std::cout << "Loot tour: the end cannot be reached from the start!" << std::endl;
+        phase_ = Phase::DONE;
+        return;
+    }
+
+    if (step_budget_ <= 0) {
+        step_budget_ = direct_distance * 2;
+    } else if (step_budget_ < direct_distance) {
+        // The end has to be reached either way; no detours fit
+        step_budget_ = direct_distance;
+    }
+    phase_ = Phase::SOLVING;
+}
+
+// ******************** TOUR SELECTION ********************
+
+void LootTourPlanner::Solve(std::chrono::steady_clock::time_point deadline) {
+    // Stops worth considering: reachable, carryable, and affordable as a single detour
+    int usable = 0;
+    for (int i = 0; i < static_cast<int>(stops_.size()); ++i) {
+        int node = i + 1;
+        int to_stop = GetDistance(0, node);
+        int to_end = GetDistance(node, GetEndNode());
+        if (to_stop >= 0 && to_end >= 0 && to_stop + to_end <= step_budget_ &&
+            stops_[i].weight <= carry_capacity_ && stops_[i].value > 0) {
+            usable++;
+        }
+    }
+
+    if (usable <= kMaxExactStops) {
+        SolveExact();
+    } else {
+        SolveHeuristic(deadline);
+    }
+
+    next_leg_ = 0;
+    path_.clear();
+    phase_ = Phase::PATHS;
+}
+
+void LootTourPlanner::SolveExact() {
+    used_exact_solver_ = true;
+    int end_node = GetEndNode();
+
+    std::vector<int> candidates;
+    for (int i = 0; i < static_cast<int>(stops_.size()); ++i) {
+        int node = i + 1;
+        int to_stop = GetDistance(0, node);
+        int to_end = GetDistance(node, end_node);
+        if (to_stop >= 0 && to_end >= 0 && to_stop + to_end <= step_budget_ &&
+            stops_[i].weight <= carry_capacity_ && stops_[i].value > 0) {
+            candidates.push_back(node);
+        }
+    }
+
+    int count = static_cast<int>(candidates.size());
+    int subset_count = 1 << count;
+    const int kUnreached = std::numeric_limits<int>::max();
+
+    // Loot totals per subset, built from the subset without its lowest member
+    std::vector<int> subset_values(subset_count, 0);
+    std::vector<float> subset_weights(subset_count, 0.0f);
+    for (int mask = 1; mask < subset_count; ++mask) {
+        int lowest = 0;
+        while (!(mask & (1 << lowest))) lowest++;
+        const LootTourStop& stop = stops_[candidates[lowest] - 1];
+        subset_values[mask] = subset_values[mask & (mask - 1)] + stop.value;
+        subset_weights[mask] = subset_weights[mask & (mask - 1)] + stop.weight;
+    }
+
+    // steps[mask][last]: shortest walk from the start through exactly mask, ending at last
+    std::vector<int> steps(static_cast<size_t>(subset_count) * std::max(1, count), kUnreached);
+    std::vector<int> previous(steps.size(), -1);
+    for (int i = 0; i < count; ++i) {
+        steps[(1 << i) * count + i] = GetDistance(0, candidates[i]);
+    }
+
+    int best_mask = 0;
+    int best_last = -1;
+    int best_value = 0;
+    int best_length = GetDistance(0, end_node);
+
+    for (int mask = 1; mask < subset_count; ++mask) {
+        if (subset_weights[mask] > carry_capacity_) continue;
+
+        for (int last = 0; last < count; ++last) {
+            int walked = steps[mask * count + last];
+            if (walked == kUnreached) continue;
+
+            // Distances obey the triangle inequality, so no extension can get back under budget
+            int length = walked + GetDistance(candidates[last], end_node);
+            if (length > step_budget_) continue;
+
+            if (subset_values[mask] > best_value || (subset_values[mask] == best_value && length < best_length)) {
+                best_value = subset_values[mask];
+                best_length = length;
+                best_mask = mask;
+                best_last = last;
+            }
+
+            for (int next = 0; next < count; ++next) {
+                int next_mask = mask | (1 << next);
+                if (next_mask == mask || subset_weights[next_mask] > carry_capacity_) continue;
+
+                int next_walked = walked + GetDistance(candidates[last], candidates[next]);
+                int& next_steps = steps[next_mask * count + next];
+                if (next_walked < next_steps) {
+                    next_steps = next_walked;
+                    previous[next_mask * count + next] = last;
+                }
+            }
+        }
+    }
+
+    tour_.clear();
+    for (int mask = best_mask, last = best_last; last >= 0;) {
+        tour_.push_back(candidates[last]);
+        int before = previous[mask * count + last];
+        mask &= ~(1 << last);
+        last = before;
+    }
+    std::reverse(tour_.begin(), tour_.end());
+}
+
+void LootTourPlanner::SolveHeuristic(std::chrono::steady_clock::time_point deadline) {
+    used_exact_solver_ = false;
+    int end_node = GetEndNode();
+
+    std::vector<uint8_t> in_tour(GetNodeCount(), 0);
+    float tour_weight = 0.0f;
+    tour_.clear();
+    int tour_length = GetDistance(0, end_node);
+
+    // The first insertion pass always runs so a late slice still yields a tour
+    bool changed = false;
+    do {
+        changed = false;
+
+        // Greedy insertion: best value per extra step among insertions that fit the budget
+        while (true) {
+            int best_node = -1;
+            int best_position = 0;
+            int best_added = 0;
+            float best_ratio = -1.0f;
+
+            for (int i = 0; i < static_cast<int>(stops_.size()); ++i) {
+                int node = i + 1;
+                const LootTourStop& stop = stops_[i];
+                if (in_tour[node] || stop.value <= 0 || GetDistance(0, node) < 0 ||
+                    tour_weight + stop.weight > carry_capacity_) {
+                    continue;
+                }
+
+                for (int position = 0; position <= static_cast<int>(tour_.size()); ++position) {
+                    int before = (position == 0) ? 0 : tour_[position - 1];
+                    int after = (position == static_cast<int>(tour_.size())) ? end_node : tour_[position];
+                    int added = GetDistance(before, node) + GetDistance(node, after) - GetDistance(before, after);
+                    if (tour_length + added > step_budget_) continue;
+
+                    float ratio = stop.value / static_cast<float>(added + 1);
+                    if (ratio > best_ratio) {
+                        best_ratio = ratio;
+                        best_node = node;
+                        best_position = position;
+                        best_added = added;
+                    }
+                }
+            }
+
+            if (best_node < 0) {
+                break;
+            }
+            tour_.insert(tour_.begin() + best_position, best_node);
+            in_tour[best_node] = 1;
+            tour_weight += stops_[best_node - 1].weight;
+            tour_length += best_added;
+            changed = true;
+        }
+
+        // 2-opt: reversing a stretch of the tour can free steps for more insertions
+        bool improved = true;
+        while (improved && std::chrono::steady_clock::now() < deadline) {
+            improved = false;
+            int size = static_cast<int>(tour_.size());
+            for (int i = 0; i < size && !improved; ++i) {
+                for (int j = i + 1; j < size && !improved; ++j) {
+                    int before = (i == 0) ? 0 : tour_[i - 1];
+                    int after = (j == size - 1) ? end_node : tour_[j + 1];
+                    int old_cost = GetDistance(before, tour_[i]) + GetDistance(tour_[j], after);
+                    int new_cost = GetDistance(before, tour_[j]) + GetDistance(tour_[i], after);
+                    if (new_cost < old_cost) {
+                        std::reverse(tour_.begin() + i, tour_.begin() + j + 1);
+                        tour_length -= old_cost - new_cost;
+                        improved = true;
+                    }
+                }
+            }
+            changed = changed || improved;
+        }
+    } while (changed && std::chrono::steady_clock::now() < deadline);
+}
+
+// ******************** PATH EXPANSION ********************
+
+template<typename TileContainer>
+void LootTourPlanner::AppendLeg(const Map<TileContainer>& game_map, const Position& from, const Position& to) {
+    int width = game_map.GetWidth();
+    int height = game_map.GetHeight();
+    workspace_.BeginSearch(width, height, IsStreamedTileContainer<TileContainer>::value);
+    std::vector<int64_t>& frontier = workspace_.GetFrontier();
+
+    int64_t target = workspace_.GetIndex(to);
+    workspace_.Visit(workspace_.GetIndex(from), 0, -1);
+    frontier.push_back(workspace_.GetIndex(from));
+
+    for (size_t head = 0; head < frontier.size() && !workspace_.IsVisited(target); ++head) {
+        int64_t index = frontier[head];
+        Position current = workspace_.GetPosition(index);
+        for (int direction = 0; direction < 4; ++direction) {
+            int nx = current.x + kDirectionX[direction];
+            int ny = current.y + kDirectionY[direction];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+
+            int64_t neighbor = workspace_.GetIndex(nx, ny);
+            if (workspace_.IsVisited(neighbor) || !game_map.GetTile(nx, ny).IsTraversable()) continue;
+
+            workspace_.Visit(neighbor, workspace_.GetDistance(index) + 1, index);
+            frontier.push_back(neighbor);
+        }
+    }
+
+    // Consecutive legs share their joining tile
+    std::vector<Position> leg = workspace_.ReconstructPath(target);
+    size_t first = path_.empty() ? 0 : 1;
+    for (size_t i = first; i < leg.size(); ++i) {
+        path_.push_back(leg[i]);
+    }
+}
+
+// ******************** RESULTS ********************
+
+std::vector<LootTourStop> LootTourPlanner::GetTourStops() const {
+    std::vector<LootTourStop> tour_stops;
+    for (int node : tour_) {
+        tour_stops.push_back(stops_[node - 1]);
+    }
+    return tour_stops;
+}
+
+int LootTourPlanner::GetTourValue() const {
+    int value = 0;
+    for (int node : tour_) {
+        value += stops_[node - 1].value;
+    }
+    return value;
+}
+
+float LootTourPlanner::GetTourWeight() const {
+    float weight = 0.0f;
+    for (int node : tour_) {
+        weight += stops_[node - 1].weight;
+    }
+    return weight;
+}
+
+void LootTourPlanner::PrintPlan() const {
+    std::cout << "\n=== LOOT TOUR PLAN ===" << std::endl;
+    std::cout << "Candidate stops: " << stops_.size()
+              << " | Solver: " << (used_exact_solver_ ? "exact (bitmask DP)" : "greedy insertion + 2-opt")
+              << std::endl;
+    std::cout << "Chosen stops: " << tour_.size() << " | Value: " << GetTourValue()
+              << " | Weight: " << std::fixed << std::setprecision(1) << GetTourWeight()
+              << "/" << carry_capacity_ << " kg" << std::endl;
+    std::cout << "Steps: " << (path_.empty() ? 0 : path_.size() - 1) << "/" << step_budget_
+              << " | Planning time: " << (planning_time_ns_ / 1000) << " microseconds" << std::endl;
+    for (int node : tour_) {
+        const LootTourStop& stop = stops_[node - 1];
+        std::cout << "  -> (" << stop.position.x << ", " << stop.position.y << ") "
+                  << stop.item_count << " item(s), value " << stop.value << std::endl;
+    }
+    std::cout << std::setprecision(6) << std::defaultfloat;
+    std::cout << "======================" << std::endl;
+}
+
+// ******************** PRIVATE HELPER METHODS ********************
+
+Position LootTourPlanner::GetNodePosition(int node) const {
+    if (node == 0) return start_;
+    if (node == GetEndNode()) return end_;
+    return stops_[node - 1].position;
+}
+
+// ******************** EXPLICIT TEMPLATE INSTANTIATIONS ********************
+
+template void LootTourPlanner::Begin<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map, const Position& start, const Position& end,
+        int step_budget, float carry_capacity);
+
+template bool LootTourPlanner::Continue<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map, long long time_budget_ns);
+
+// Flat row-major grid (the default Map<> container)
+
+template void LootTourPlanner::Begin<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map, const Position& start, const Position& end,
+        int step_budget, float carry_capacity);
+
+template bool LootTourPlanner::Continue<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map, long long time_budget_ns);
+
+// Morton-ordered 8x8 blocks
+
+template void LootTourPlanner::Begin<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map, const Position& start, const Position& end,
+        int step_budget, float carry_capacity);
+
+template bool LootTourPlanner::Continue<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map, long long time_budget_ns);
+
+// Type byte plus bit planes
+
+template void LootTourPlanner::Begin<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map, const Position& start, const Position& end,
+        int step_budget, float carry_capacity);
+
+template bool LootTourPlanner::Continue<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map, long long time_budget_ns);
+
+// Build-time 64x64 grid
+
+template void LootTourPlanner::Begin<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map, const Position& start, const Position& end,
+        int step_budget, float carry_capacity);
+
+template bool LootTourPlanner::Continue<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map, long long time_budget_ns);
+
+// Streamed 64x64 chunks
+
+template void LootTourPlanner::Begin<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map, const Position& start, const Position& end,
+        int step_budget, float carry_capacity);
+
+template bool LootTourPlanner::Continue<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map, long long time_budget_ns);
+
+// Memory-mapped map file
+
+template void LootTourPlanner::Begin<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map, const Position& start, const Position& end,
+        int step_budget, float carry_capacity);
+
+template bool LootTourPlanner::Continue<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map, long long time_budget_ns);
@@ -0,0 +1,118 @@
+#ifndef RAYLIBSTARTER_LOOTTOURPLANNER_H
+#define RAYLIBSTARTER_LOOTTOURPLANNER_H
+
+#include "Tile.h"
+#include "SearchWorkspace.h"
+#include <vector>
+#include <unordered_map>
+#include <chrono>
+#include <cstdint>
+
+// Forward declaration
+template<typename TileContainer> class Map;
+
+// ******************** LOOT STOP STRUCTURE ********************
+
+// Every tile with collectable items is one stop; item values and weights are summed
+struct LootTourStop {
+    Position position;
+    int value;
+    float weight;
+    int item_count;
+
+    LootTourStop(const Position& pos) : position(pos), value(0), weight(0.0f), item_count(0) {}
+};
+
+// ******************** LOOT TOUR PLANNER ********************
+
+// Chooses which item tiles to visit between start and end (orienteering): maximize the
+// collected value while the tour stays within a step budget and the loot within the carry
+// capacity. Planning is split into slices so it can run under a per-frame time budget:
+//   1. one-to-all breadth-first searches from start and every stop fill a distance matrix
+//   2. exact bitmask DP for up to kMaxExactStops stops, greedy insertion + 2-opt above that
+//   3. the chosen tour is expanded into single steps, one leg per slice
+class LootTourPlanner {
+public:
+    enum class Phase {
+        IDLE,
+        DISTANCES,
+        SOLVING,
+        PATHS,
+        DONE
+    };
+
+    static const int kMaxExactStops = 12;
+
+    // Constructor
+    LootTourPlanner();
+
+    // Destructor
+    ~LootTourPlanner();
+
+    // Planning; a step budget <= 0 allows twice the direct start-to-end distance,
+    // and a budget below the direct distance is raised to it
+    template<typename TileContainer>
+    void Begin(const Map<TileContainer>& game_map, const Position& start, const Position& end,
+               int step_budget, float carry_capacity);
+
+    // Runs planning slices until done or the time budget is used up; returns true when done
+    template<typename TileContainer>
+    bool Continue(const Map<TileContainer>& game_map, long long time_budget_ns);
+
+    void Reset();
+
+    // Results
+    Phase GetPhase() const { return phase_; }
+    bool IsDone() const { return phase_ == Phase::DONE; }
+    bool HasPath() const { return !path_.empty(); }
+    const std::vector<Position>& GetPath() const { return path_; }
+    std::vector<LootTourStop> GetTourStops() const;
+    int GetTourValue() const;
+    float GetTourWeight() const;
+    int GetStepBudget() const { return step_budget_; }
+    void PrintPlan() const;
+
+private:
+    Phase phase_;
+    Position start_;
+    Position end_;
+    int step_budget_;
+    float carry_capacity_;
+
+    // Graph nodes: 0 = start, 1..n = stops, n + 1 = end
+    std::vector<LootTourStop> stops_;
+    std::unordered_map<int64_t, int> node_at_tile_;  // Workspace tile index -> node id
+    std::vector<int> distances_;          // Row-major node x node matrix, -1 = unreachable
+    int next_source_;
+
+    // Chosen stops (node ids) in visit order
+    std::vector<int> tour_;
+
+    // Path expansion
+    std::vector<Position> path_;
+    int next_leg_;
+
+    SearchWorkspace workspace_;
+    long long planning_time_ns_;
+    bool used_exact_solver_;
+
+    // Phases
+    template<typename TileContainer>
+    void RunDistanceSearch(const Map<TileContainer>& game_map, int source_node);
+
+    template<typename TileContainer>
+    void AppendLeg(const Map<TileContainer>& game_map, const Position& from, const Position& to);
+
+    void FinishDistances();
+    void Solve(std::chrono::steady_clock::time_point deadline);
+    void SolveExact();
+    void SolveHeuristic(std::chrono::steady_clock::time_point deadline);
+
+    // Helpers
+    int GetNodeCount() const { return static_cast<int>(stops_.size()) + 2; }
+    int GetEndNode() const { return static_cast<int>(stops_.size()) + 1; }
+    int GetDistance(int from_node, int to_node) const { return distances_[from_node * GetNodeCount() + to_node]; }
+    Position GetNodePosition(int node) const;
+};
+
+#endif //RAYLIBSTARTER_LOOTTOURPLANNER_H
@@ -5,15 +5,57 @@
 #include "items/ItemManager.h"
 #include "raylib.h"
 #include "TextureManager.h"
+#include "FlatTileGrid.h"
+#include "MortonTileGrid.h"
+#include "CompactTileGrid.h"
+#include "FixedGrid.h"
+#include "ChunkedTileGrid.h"
+#include "MappedTileGrid.h"
+#include "MapFile.h"
+#include "ThreadPool.h"
+#include "CounterRng.h"
+#include "NeighborMask.h"
+#include "TileUnionFind.h"
 #include <vector>
 #include <memory>
 #include <iostream>
+#include <atomic>
+#include <utility>
+#include <string>
+#include <cstring>
+#include <algorithm>
+#include <cstdint>
+#include <climits>
+
+// ******************** MAP REVISIONS ********************
+
+// One counter for every map, so a revision never repeats even if a map is replaced
+inline unsigned long long NextMapRevision() {
+    static std::atomic<unsigned long long> revision_counter(0);
+    return ++revision_counter;
+}
 
 // ******************** TEMPLATED MAP CLASS ********************
 
-template<typename TileContainer = std::vector<std::vector<Tile>>>
+// TileContainer is indexed as tiles[y][x] and sized with ResizeTileContainer: nested vectors,
+// FlatTileGrid (row-major), MortonTileGrid (8x8 Morton blocks), CompactTileGrid (type byte
+// plus bit planes, whose tiles are TileView values instead of Tile references),
+// FixedGrid<W, H> (build-time size; the map ignores the sizes passed to it), ChunkedTileGrid
+// (streamed chunks; the terrain comes from the grid's chunk source and the map places no
+// start/end tiles or items) or MappedTileGrid (tile types read in place from a map file)
+template<typename TileContainer = FlatTileGrid>
 class Map {
 public:
+    // Build-time size, 0 for containers sized at runtime
+    static constexpr int kFixedWidth = TileContainerExtent<TileContainer>::kWidth;
+    static constexpr int kFixedHeight = TileContainerExtent<TileContainer>::kHeight;
+    static constexpr bool kIsFixedSize = kFixedWidth > 0;
+    static constexpr bool kIsStreamed = IsStreamedTileContainer<TileContainer>::value;
+
+    // What GetTile returns: Tile& / const Tile& for containers of Tile, a view for CompactTileGrid
+    using TileReference = decltype(std::declval<TileContainer&>()[0][0]);
+    using ConstTileReference = decltype(std::declval<const TileContainer&>()[0][0]);
+
     // Constructors
     Map();
     Map(int width, int height);
@@ -21,16 +63,35 @@ public:
     // Destructor
     ~Map();
 
-    // Map Generation
+    // Map Generation (terrain from a seed is the same for any thread count; the overloads
+    // without one draw the seed from raylib's generator)
     void GenerateStaticMap();
     void GenerateRandomMap();
+    void GenerateRandomMap(uint64_t seed);
     void GenerateTerrainWithClustering();
+    void GenerateTerrainWithClustering(uint64_t seed);
+
+    // Threads for the per-tile generation passes; nullptr uses ThreadPool::GetShared()
+    void SetGenerationThreadPool(ThreadPool* pool) { generation_pool_ = pool; }
+
+    // Map Loading (row-major tile types, no size limits, no items); false leaves the map unchanged
+    bool LoadTerrain(int width, int height, const std::vector<TileType>& tile_types);
+
+    // Map Files (binary, see MapFile.h; MappedTileGrid maps the tiles without copying them)
+    bool LoadMapFile(const std::string& file_path);
+    bool SaveMapFile(const std::string& file_path) const;
 
     // Tile Access
-    Tile& GetTile(int x, int y);
-    const Tile& GetTile(int x, int y) const;
-    Tile& GetTile(const Position& pos);
-    const Tile& GetTile(const Position& pos) const;
+    TileReference GetTile(int x, int y);
+    ConstTileReference GetTile(int x, int y) const;
+    TileReference GetTile(const Position& pos);
+    ConstTileReference GetTile(const Position& pos) const;
+
+    // Tile Changes (tracked, so cached analyses can update incrementally;
+    // edits made through the mutable GetTile() are not tracked)
+    void SetTileType(const Position& pos, TileType type);
+    unsigned long long GetRevision() const { return revision_; }
+    bool GetTileChangesSince(unsigned long long revision, std::vector<Position>& changed_tiles) const;
 
     // Item System Access
     ItemManager& GetItemManager() { return item_manager_; }
@@ -39,16 +100,25 @@ public:
     bool HasItemsAt(const Position& pos) const;
     void OpenTreasureChestAt(const Position& pos);
 
+    // Container Access (configuration of specialised containers, e.g. a chunk source)
+    TileContainer& GetTileContainer() { return tiles_; }
+    const TileContainer& GetTileContainer() const { return tiles_; }
+
     // Map Properties
-    int GetWidth() const { return width_; }
-    int GetHeight() const { return height_; }
+    int GetWidth() const { return kIsFixedSize ? kFixedWidth : width_; }
+    int GetHeight() const { return kIsFixedSize ? kFixedHeight : height_; }
     Position GetStartPosition() const { return start_pos_; }
     Position GetEndPosition() const { return end_pos_; }
 
     // Validation
     bool IsValidPosition(int x, int y) const;
     bool IsValidPosition(const Position& pos) const;
-    bool HasValidPath() const;
+    bool HasValidPath() const; // Flood fill, cached until the revision changes
+
+    // Connectivity: whether two traversable tiles share a 4-way region. Regions are kept in a
+    // union-find that tiles opened by tracked changes merge into; other changes rebuild it.
+    // Streamed maps are never scanned whole and report every pair of traversable tiles as connected
+    bool AreConnected(const Position& first, const Position& second) const;
 
     // Rendering
     void Render(int offset_x, int offset_y, int tile_size) const;
@@ -67,64 +137,150 @@ private:
     // Item management
     ItemManager item_manager_;
 
+    // Change tracking
+    struct TileChange {
+        Position position;
+        unsigned long long revision;
+    };
+    static const int kMaxTrackedTileChanges = 1024;
+    unsigned long long revision_;             // Unique across all maps, so caches cannot mix up two maps
+    unsigned long long full_change_revision_; // Revision of the last whole-map change
+    std::vector<TileChange> tile_changes_;
+
+    // Path validation, cached per revision (HasValidPath is const, so the cache is mutable and a
+    // map must not be validated from two threads at once)
+    mutable unsigned long long path_check_revision_; // 0 until the first check
+    mutable bool path_check_result_;
+    mutable std::vector<uint64_t> path_visited_bits_; // One bit per tile, row-major
+    mutable std::vector<Position> path_stack_;
+
+    // Traversable regions for AreConnected, same threading rule as the path cache
+    mutable unsigned long long region_revision_; // 0 until first needed
+    mutable TileUnionFind regions_;
+
+    // Generation passes: rows are processed in bands of kGenerationBandRows on the pool, and
+    // every pass draws from one CounterRng stream per row
+    enum GenerationPass : uint32_t {
+        kStartEndPass,
+        kClusterPass,
+        kBlockedTilesPass,
+        kStoneScatterPass,
+        kFillPass
+    };
+    static const int kGenerationBandRows = 64;
+    ThreadPool* generation_pool_;
+
+    static uint64_t GetRowStream(GenerationPass pass, int y) {
+        return (static_cast<uint64_t>(pass) << 32) | static_cast<uint32_t>(y);
+    }
+    static uint64_t DrawGenerationSeed();
+    template<typename BandFunction>
+    void ForEachRowBand(const BandFunction& process_band) const;
+
     // Helper methods
     void InitializeMap();
-    void PlaceStartAndEnd();
-    void GenerateBlockedTiles(float blocked_ratio = 0.3f);
-    void GenerateClusteredTerrain();
-    void PlaceWaterClusters();
-    void PlaceVegetationClusters();
-    void FillTraversableAreas();
+    void PlaceStartAndEnd(uint64_t seed);
+    void GenerateBlockedTiles(uint64_t seed, float blocked_ratio = 0.3f);
+    void GenerateClusteredTerrain(uint64_t seed);
+    void PlaceWaterClusters(CounterRng& rng);
+    void PlaceVegetationClusters(CounterRng& rng);
+    void ScatterStoneBlocks(uint64_t seed, float stone_ratio);
+    void FillTraversableAreas(uint64_t seed);
 
     // Item and treasure chest placement
     void PlaceItemsAndTreasureChests();
     void PlaceTreasureChests();
 
-    int CountBlockedNeighbors(int x, int y) const;
-    int CountWaterNeighbors(int x, int y) const;
+    // Neighbour counts of every tile (row-major, width * height), from one NeighborMask sweep
+    template<typename Predicate>
+    void CountMatchingNeighbors(const Predicate& matches, std::vector<uint8_t>& counts) const;
+    void CountBlockedNeighbors(std::vector<uint8_t>& counts) const;
+    void CountWaterNeighbors(std::vector<uint8_t>& counts) const;
     bool ValidatePathExists() const;
-    bool DepthFirstSearch(Position current, Position target,
-                          std::vector<std::vector<bool>>& visited) const;
-    void EnsurePathExists();
+    void UpdateRegions() const;
+    void UniteWithTraversableNeighbors(int x, int y) const;
+    void ConnectTraversableRegions();
+    void MarkAllTilesChanged();
 };
 
 // ******************** TEMPLATE IMPLEMENTATION ********************
 
 template<typename TileContainer>
-Map<TileContainer>::Map() : width_(15), height_(15) {
+Map<TileContainer>::Map()
+        : width_(kIsFixedSize ? kFixedWidth : 15), height_(kIsFixedSize ? kFixedHeight : 15),
+          revision_(NextMapRevision()), full_change_revision_(revision_), path_check_revision_(0),
+          path_check_result_(false), region_revision_(0), generation_pool_(nullptr) {
     InitializeMap();
-    GenerateStaticMap();
+    if (!kIsStreamed) {
+        GenerateStaticMap();
+    }
 }
 
 template<typename TileContainer>
-Map<TileContainer>::Map(int width, int height) : width_(width), height_(height) {
+Map<TileContainer>::Map(int width, int height)
+        : width_(width), height_(height), revision_(NextMapRevision()), full_change_revision_(revision_),
+          path_check_revision_(0), path_check_result_(false), region_revision_(0), generation_pool_(nullptr) {
     if (width_ < 15) width_ = 15;
     if (height_ < 15) height_ = 15;
+    if (kIsFixedSize) {
+        width_ = kFixedWidth;
+        height_ = kFixedHeight;
+    }
 
     InitializeMap();
-    GenerateStaticMap();
+    if (!kIsStreamed) {
+        GenerateStaticMap();
+    }
 }
 
 template<typename TileContainer>
 Map<TileContainer>::~Map() {
-    // No dynamic cleanup needed for std::vector
+    // No dynamic cleanup needed for the tile container
 }
 
 template<typename TileContainer>
 void Map<TileContainer>::InitializeMap() {
-    tiles_.resize(height_);
-    for (int y = 0; y < height_; ++y) {
-        tiles_[y].resize(width_);
-        for (int x = 0; x < width_; ++x) {
-            tiles_[y][x] = Tile(TileType::TRAVERSABLE_DIRT, x, y);
-        }
+    ResizeTileContainer(tiles_, width_, height_);
+    if (kIsStreamed) {
+        return; // Chunks are filled by their source when first read
     }
+
+    ForEachRowBand([this](int first_row, int end_row) {
+        for (int y = first_row; y < end_row; ++y) {
+            for (int x = 0; x < width_; ++x) {
+                tiles_[y][x] = Tile(TileType::TRAVERSABLE_DIRT, x, y);
+            }
+        }
+    });
+}
+
+template<typename TileContainer>
+uint64_t Map<TileContainer>::DrawGenerationSeed() {
+    uint64_t high = static_cast<uint64_t>(GetRandomValue(0, 0x3FFFFFFF));
+    uint64_t low = static_cast<uint64_t>(GetRandomValue(0, 0x3FFFFFFF));
+    return (high << 30) | low;
+}
+
+template<typename TileContainer>
+template<typename BandFunction>
+void Map<TileContainer>::ForEachRowBand(const BandFunction& process_band) const {
+    int alignment = std::max(1, GetRowBandAlignment(tiles_, width_));
+    int band_rows = alignment >= height_ ? height_
+                                         : (kGenerationBandRows + alignment - 1) / alignment * alignment;
+    if (band_rows <= 0) return;
+
+    int band_count = (height_ + band_rows - 1) / band_rows;
+    ThreadPool& pool = generation_pool_ ? *generation_pool_ : ThreadPool::GetShared();
+    pool.ParallelFor(band_count, [&](int band) {
+        int first_row = band * band_rows;
+        process_band(first_row, std::min(height_, first_row + band_rows));
+    });
 }
 
 template<typename TileContainer>
 void Map<TileContainer>::GenerateStaticMap() {
     InitializeMap();
-    PlaceStartAndEnd();
+    PlaceStartAndEnd(DrawGenerationSeed());
 
     // Add some blocked tiles in a pattern
     for (int y = 1; y < height_ - 1; ++y) {
@@ -141,88 +297,237 @@ void Map<TileContainer>::GenerateStaticMap() {
         }
     }
 
-    EnsurePathExists();
+    ConnectTraversableRegions();
     PlaceItemsAndTreasureChests();  // Ensure this is called!
+    MarkAllTilesChanged();
 }
 
 template<typename TileContainer>
 void Map<TileContainer>::GenerateRandomMap() {
+    GenerateRandomMap(DrawGenerationSeed());
+}
+
+template<typename TileContainer>
+void Map<TileContainer>::GenerateRandomMap(uint64_t seed) {
     InitializeMap();
-    PlaceStartAndEnd();
-    GenerateBlockedTiles();
-    EnsurePathExists();
+    PlaceStartAndEnd(seed);
+    GenerateBlockedTiles(seed);
+    ConnectTraversableRegions();
     PlaceItemsAndTreasureChests();  // Ensure this is called!
+    MarkAllTilesChanged();
 }
 
 template<typename TileContainer>
 void Map<TileContainer>::GenerateTerrainWithClustering() {
-    PlaceStartAndEnd();
-    GenerateClusteredTerrain();
-    EnsurePathExists();
+    GenerateTerrainWithClustering(DrawGenerationSeed());
+}
+
+template<typename TileContainer>
+void Map<TileContainer>::GenerateTerrainWithClustering(uint64_t seed) {
+    InitializeMap();
+    PlaceStartAndEnd(seed);
+    GenerateClusteredTerrain(seed);
+    ConnectTraversableRegions();
     PlaceItemsAndTreasureChests();
+    MarkAllTilesChanged();
 }
 
 template<typename TileContainer>
-void Map<TileContainer>::GenerateBlockedTiles(float blocked_ratio) {
-    int total_tiles = width_ * height_;
-    int blocked_count = static_cast<int>(total_tiles * blocked_ratio);
+bool Map<TileContainer>::LoadTerrain(int width, int height, const std::vector<TileType>& tile_types) {
+    if (kIsFixedSize && (width != kFixedWidth || height != kFixedHeight)) {
+        std::cout << "Cannot load " << width << "x" << height << " terrain into a fixed "
+                  << kFixedWidth << "x" << kFixedHeight << " map" << std::endl;
+        return false;
+    }
+    if (width <= 0 || height <= 0 || tile_types.size() < static_cast<size_t>(width) * height) {
+        std::cout << "Cannot load " << width << "x" << height << " terrain from "
+                  << tile_types.size() << " tile types" << std::endl;
+        return false;
+    }
+
+    width_ = width;
+    height_ = height;
+    InitializeMap();
 
-    for (int i = 0; i < blocked_count; ++i) {
-        int x = GetRandomValue(0, width_ - 1);
-        int y = GetRandomValue(1, height_ - 2); // Avoid first and last row
+    for (int y = 0; y < height_; ++y) {
+        for (int x = 0; x < width_; ++x) {
+            tiles_[y][x].SetType(tile_types[y * width_ + x]);
+        }
+    }
+
+    // Loaded terrain has no START/END tiles; use the first and last traversable tiles
+    start_pos_ = Position(0, 0);
+    end_pos_ = Position(0, 0);
+    bool found_start = false;
+    for (int y = 0; y < height_; ++y) {
+        for (int x = 0; x < width_; ++x) {
+            if (tiles_[y][x].IsTraversable()) {
+                if (!found_start) {
+                    start_pos_ = Position(x, y);
+                    found_start = true;
+                }
+                end_pos_ = Position(x, y);
+            }
+        }
+    }
 
-        // Don't block start or end positions
-        if (Position(x, y) == start_pos_ || Position(x, y) == end_pos_) {
+    item_manager_.ClearAllItems();
+    ClearTileItemMarks(tiles_);
+    MarkAllTilesChanged();
+    return true;
+}
+
+template<typename TileContainer>
+bool Map<TileContainer>::LoadMapFile(const std::string& file_path) {
+    if (kIsStreamed) {
+        std::cout << "Cannot load a map file into a streamed map" << std::endl;
+        return false;
+    }
+
+    auto map_file = std::make_shared<MapFile>();
+    if (!map_file->Open(file_path)) {
+        return false;
+    }
+
+    const MapFileHeader& header = map_file->GetHeader();
+    if (kIsFixedSize && (header.width != kFixedWidth || header.height != kFixedHeight)) {
+        std::cout << "Cannot load " << header.width << "x" << header.height << " map file into a fixed "
+                  << kFixedWidth << "x" << kFixedHeight << " map" << std::endl;
+        return false;
+    }
+
+    width_ = header.width;
+    height_ = header.height;
+    if (!AttachMapFile(tiles_, map_file)) {
+        InitializeMap();
+        const uint8_t* tile_types = map_file->GetTypePlane();
+        for (int y = 0; y < height_; ++y) {
+            for (int x = 0; x < width_; ++x) {
+                tiles_[y][x].SetType(TileTypeFromByte(tile_types[static_cast<std::size_t>(y) * width_ + x]));
+            }
+        }
+    }
+
+    start_pos_ = Position(header.start_x, header.start_y);
+    end_pos_ = Position(header.end_x, header.end_y);
+
+    item_manager_.ClearAllItems();
+    ClearTileItemMarks(tiles_);
+    const MapFileItem* items = map_file->GetItems();
+    for (uint32_t i = 0; i < header.item_count; ++i) {
+        // Entries may be longer in newer versions; the known fields come first
+        const MapFileItem& entry = *reinterpret_cast<const MapFileItem*>(
+                reinterpret_cast<const char*>(items) + static_cast<std::size_t>(i) * header.item_entry_bytes);
+        Position pos(entry.x, entry.y);
+        if (!IsValidPosition(pos)) {
             continue;
         }
 
-        tiles_[y][x].SetType(Tile::GetRandomBlockedType());
+        std::string type_key(entry.type_key, strnlen(entry.type_key, sizeof(entry.type_key)));
+        item_manager_.AddItem(pos, ItemManager::CreateItemOfType(type_key, entry.stack_count),
+                              entry.in_treasure_chest != 0);
+        MarkTileItems(tiles_, pos.x, pos.y);
     }
+
+    MarkAllTilesChanged();
+    return true;
 }
 
 template<typename TileContainer>
-void Map<TileContainer>::PlaceStartAndEnd() {
-    // Clear any existing start/end tiles first
+bool Map<TileContainer>::SaveMapFile(const std::string& file_path) const {
+    if (kIsStreamed) {
+        std::cout << "Cannot save a streamed map to a map file" << std::endl;
+        return false;
+    }
+
+    std::vector<uint8_t> tile_types(static_cast<std::size_t>(width_) * height_);
     for (int y = 0; y < height_; ++y) {
         for (int x = 0; x < width_; ++x) {
-            if (tiles_[y][x].GetType() == TileType::START ||
-                tiles_[y][x].GetType() == TileType::END) {
-                tiles_[y][x].SetType(TileType::TRAVERSABLE_DIRT);
-            }
+            tile_types[static_cast<std::size_t>(y) * width_ + x] = static_cast<uint8_t>(tiles_[y][x].GetType());
         }
     }
 
+    std::vector<MapFileItem> items;
+    for (const auto& item_with_pos : item_manager_.GetAllItems()) {
+        MapFileItem entry = {};
+        entry.x = item_with_pos.position.x;
+        entry.y = item_with_pos.position.y;
+        entry.stack_count = ItemManager::GetItemStackCount(*item_with_pos.item);
+        entry.in_treasure_chest = item_with_pos.is_in_treasure_chest ? 1 : 0;
+        std::string type_key = ItemManager::GetItemTypeKey(*item_with_pos.item);
+        std::memcpy(entry.type_key, type_key.c_str(), std::min(type_key.size(), sizeof(entry.type_key)));
+        items.push_back(entry);
+    }
+
+    MapFileHeader header = {};
+    header.width = width_;
+    header.height = height_;
+    header.start_x = start_pos_.x;
+    header.start_y = start_pos_.y;
+    header.end_x = end_pos_.x;
+    header.end_y = end_pos_.y;
+    return MapFile::Write(file_path, header, tile_types.data(), items);
+}
+
+template<typename TileContainer>
+void Map<TileContainer>::GenerateBlockedTiles(uint64_t seed, float blocked_ratio) {
+    // Each tile is blocked with probability blocked_ratio; the first and last rows, which hold
+    // start and end, stay open
+    ForEachRowBand([&](int first_row, int end_row) {
+        for (int y = std::max(first_row, 1); y < std::min(end_row, height_ - 1); ++y) {
+            CounterRng rng(seed, GetRowStream(kBlockedTilesPass, y));
+            for (int x = 0; x < width_; ++x) {
+                if (rng.Uniform() < blocked_ratio) {
+                    tiles_[y][x].SetType(Tile::GetRandomBlockedType(rng));
+                }
+            }
+        }
+    });
+}
+
+template<typename TileContainer>
+void Map<TileContainer>::PlaceStartAndEnd(uint64_t seed) {
+    // Runs right after InitializeMap, so there are no old start/end tiles to clear
+    CounterRng rng(seed, GetRowStream(kStartEndPass, 0));
+
     // Place start on first row
-    int start_x = GetRandomValue(0, width_ - 1);
+    int start_x = rng.Range(0, width_ - 1);
     start_pos_ = Position(start_x, 0);
     tiles_[0][start_x].SetType(TileType::START);
 
     // Place end on last row
-    int end_x = GetRandomValue(0, width_ - 1);
+    int end_x = rng.Range(0, width_ - 1);
     end_pos_ = Position(end_x, height_ - 1);
     tiles_[height_ - 1][end_x].SetType(TileType::END);
 }
 
 template<typename TileContainer>
-void Map<TileContainer>::GenerateClusteredTerrain() {
+void Map<TileContainer>::GenerateClusteredTerrain(uint64_t seed) {
+    // The few clusters are placed in order from one stream
+    CounterRng cluster_rng(seed, GetRowStream(kClusterPass, 0));
+
     // Place water clusters
-    PlaceWaterClusters();
+    PlaceWaterClusters(cluster_rng);
 
     // Place vegetation clusters (trees/bushes)
-    PlaceVegetationClusters();
+    PlaceVegetationClusters(cluster_rng);
+
+    // Scatter stone blocks over 1/20 to 1/15 of the map
+    float stone_ratio = 1.0f / 20.0f + cluster_rng.Uniform() * (1.0f / 15.0f - 1.0f / 20.0f);
+    ScatterStoneBlocks(seed, stone_ratio);
 
     // Fill remaining traversable areas with different tiles
-    FillTraversableAreas();
+    FillTraversableAreas(seed);
 }
 
 template<typename TileContainer>
-void Map<TileContainer>::PlaceWaterClusters() {
-    int water_clusters = GetRandomValue(2, 4);
+void Map<TileContainer>::PlaceWaterClusters(CounterRng& rng) {
+    int water_clusters = rng.Range(2, 4);
 
     for (int cluster = 0; cluster < water_clusters; ++cluster) {
         // Pick random starting point (avoid first and last rows)
-        int start_x = GetRandomValue(1, width_ - 2);
-        int start_y = GetRandomValue(2, height_ - 3);
+        int start_x = rng.Range(1, width_ - 2);
+        int start_y = rng.Range(2, height_ - 3);
 
         // Skip if start/end positions
         if (Position(start_x, start_y) == start_pos_ || Position(start_x, start_y) == end_pos_) {
@@ -230,7 +535,7 @@ void Map<TileContainer>::PlaceWaterClusters() {
         }
 
         // Create small water cluster (2-4 tiles)
-        int cluster_size = GetRandomValue(2, 4);
+        int cluster_size = rng.Range(2, 4);
         std::vector<Position> cluster_positions;
         cluster_positions.push_back(Position(start_x, start_y));
 
@@ -238,9 +543,9 @@ void Map<TileContainer>::PlaceWaterClusters() {
             // Try to place water near existing water
             bool placed = false;
             for (int attempts = 0; attempts < 10 && !placed; ++attempts) {
-                Position base = cluster_positions[GetRandomValue(0, cluster_positions.size() - 1)];
-                int new_x = base.x + GetRandomValue(-1, 1);
-                int new_y = base.y + GetRandomValue(-1, 1);
+                Position base = cluster_positions[rng.Range(0, static_cast<int>(cluster_positions.size()) - 1)];
+                int new_x = base.x + rng.Range(-1, 1);
+                int new_y = base.y + rng.Range(-1, 1);
 
                 if (IsValidPosition(new_x, new_y) &&
                     Position(new_x, new_y) != start_pos_ &&
@@ -260,12 +565,12 @@ void Map<TileContainer>::PlaceWaterClusters() {
 }
 
 template<typename TileContainer>
-void Map<TileContainer>::PlaceVegetationClusters() {
-    int vegetation_clusters = GetRandomValue(3, 6);
+void Map<TileContainer>::PlaceVegetationClusters(CounterRng& rng) {
+    int vegetation_clusters = rng.Range(3, 6);
 
     for (int cluster = 0; cluster < vegetation_clusters; ++cluster) {
-        int start_x = GetRandomValue(0, width_ - 1);
-        int start_y = GetRandomValue(1, height_ - 2);
+        int start_x = rng.Range(0, width_ - 1);
+        int start_y = rng.Range(1, height_ - 2);
 
         // Skip if start/end positions or already water
         if (Position(start_x, start_y) == start_pos_ ||
@@ -275,17 +580,17 @@ void Map<TileContainer>::PlaceVegetationClusters() {
         }
 
         // Choose vegetation type for this cluster
-        TileType vegetation_type = (GetRandomValue(0, 1) == 0) ?
+        TileType vegetation_type = (rng.Range(0, 1) == 0) ?
                                    TileType::BLOCKED_TREE : TileType::BLOCKED_BUSHES;
 
         // Create small vegetation cluster
-        int cluster_size = GetRandomValue(1, 3);
+        int cluster_size = rng.Range(1, 3);
         tiles_[start_y][start_x].SetType(vegetation_type);
 
         // Add nearby vegetation
         for (int i = 1; i < cluster_size; ++i) {
-            int new_x = start_x + GetRandomValue(-1, 1);
-            int new_y = start_y + GetRandomValue(-1, 1);
+            int new_x = start_x + rng.Range(-1, 1);
+            int new_y = start_y + rng.Range(-1, 1);
 
             if (IsValidPosition(new_x, new_y) &&
                 Position(new_x, new_y) != start_pos_ &&
@@ -296,64 +601,75 @@ void Map<TileContainer>::PlaceVegetationClusters() {
             }
         }
     }
-
-    // Scatter some stone blocks
-    int stone_count = GetRandomValue(width_ * height_ / 20, width_ * height_ / 15);
-    for (int i = 0; i < stone_count; ++i) {
-        int x = GetRandomValue(0, width_ - 1);
-        int y = GetRandomValue(1, height_ - 2);
-
-        if (Position(x, y) != start_pos_ &&
-            Position(x, y) != end_pos_ &&
-            !Tile::IsBlockedType(tiles_[y][x].GetType())) {
-
-            tiles_[y][x].SetType(TileType::BLOCKED_STONE);
-        }
-    }
 }
 
 template<typename TileContainer>
-void Map<TileContainer>::FillTraversableAreas() {
-    for (int y = 0; y < height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            // Skip if already blocked or start/end
-            if (Tile::IsBlockedType(tiles_[y][x].GetType()) ||
-                tiles_[y][x].GetType() == TileType::START ||
-                tiles_[y][x].GetType() == TileType::END) {
-                continue;
+void Map<TileContainer>::ScatterStoneBlocks(uint64_t seed, float stone_ratio) {
+    ForEachRowBand([&](int first_row, int end_row) {
+        for (int y = std::max(first_row, 1); y < std::min(end_row, height_ - 1); ++y) {
+            CounterRng rng(seed, GetRowStream(kStoneScatterPass, y));
+            for (int x = 0; x < width_; ++x) {
+                if (rng.Uniform() < stone_ratio &&
+                    Position(x, y) != start_pos_ &&
+                    Position(x, y) != end_pos_ &&
+                    !Tile::IsBlockedType(tiles_[y][x].GetType())) {
+
+                    tiles_[y][x].SetType(TileType::BLOCKED_STONE);
+                }
             }
+        }
+    });
+}
 
-            // Count blocked neighbors to determine terrain preference
-            int blocked_neighbors = CountBlockedNeighbors(x, y);
-
-            if (blocked_neighbors == 0) {
-                // Open area - prefer grass
-                if (GetRandomValue(0, 100) < 60) {
-                    tiles_[y][x].SetType(TileType::TRAVERSABLE_GRASS);
-                } else if (GetRandomValue(0, 100) < 30) {
-                    tiles_[y][x].SetType(TileType::TRAVERSABLE_STONE);
-                } else {
-                    tiles_[y][x].SetType(TileType::TRAVERSABLE_DIRT);
-                }
-            } else if (blocked_neighbors <= 2) {
-                // Some neighbors - mixed terrain
-                if (GetRandomValue(0, 100) < 40) {
-                    tiles_[y][x].SetType(TileType::TRAVERSABLE_DIRT);
-                } else if (GetRandomValue(0, 100) < 35) {
-                    tiles_[y][x].SetType(TileType::TRAVERSABLE_STONE);
-                } else {
-                    tiles_[y][x].SetType(TileType::TRAVERSABLE_GRASS);
+template<typename TileContainer>
+void Map<TileContainer>::FillTraversableAreas(uint64_t seed) {
+    // Neighbour counts first, since the fill rewrites tiles that other bands read
+    std::vector<uint8_t> blocked_neighbor_counts;
+    CountBlockedNeighbors(blocked_neighbor_counts);
+
+    ForEachRowBand([&](int first_row, int end_row) {
+        for (int y = first_row; y < end_row; ++y) {
+            CounterRng rng(seed, GetRowStream(kFillPass, y));
+            for (int x = 0; x < width_; ++x) {
+                // Skip if already blocked or start/end
+                if (Tile::IsBlockedType(tiles_[y][x].GetType()) ||
+                    tiles_[y][x].GetType() == TileType::START ||
+                    tiles_[y][x].GetType() == TileType::END) {
+                    continue;
                 }
-            } else {
-                // Many blocked neighbors - prefer dirt paths
-                if (GetRandomValue(0, 100) < 70) {
-                    tiles_[y][x].SetType(TileType::TRAVERSABLE_DIRT);
+
+                // Count blocked neighbors to determine terrain preference
+                int blocked_neighbors = blocked_neighbor_counts[static_cast<size_t>(y) * width_ + x];
+
+                if (blocked_neighbors == 0) {
+                    // Open area - prefer grass
+                    if (rng.Range(0, 100) < 60) {
+                        tiles_[y][x].SetType(TileType::TRAVERSABLE_GRASS);
+                    } else if (rng.Range(0, 100) < 30) {
+                        tiles_[y][x].SetType(TileType::TRAVERSABLE_STONE);
+                    } else {
+                        tiles_[y][x].SetType(TileType::TRAVERSABLE_DIRT);
+                    }
+                } else if (blocked_neighbors <= 2) {
+                    // Some neighbors - mixed terrain
+                    if (rng.Range(0, 100) < 40) {
+                        tiles_[y][x].SetType(TileType::TRAVERSABLE_DIRT);
+                    } else if (rng.Range(0, 100) < 35) {
+                        tiles_[y][x].SetType(TileType::TRAVERSABLE_STONE);
+                    } else {
+                        tiles_[y][x].SetType(TileType::TRAVERSABLE_GRASS);
+                    }
                 } else {
-                    tiles_[y][x].SetType(TileType::TRAVERSABLE_STONE);
+                    // Many blocked neighbors - prefer dirt paths
+                    if (rng.Range(0, 100) < 70) {
+                        tiles_[y][x].SetType(TileType::TRAVERSABLE_DIRT);
+                    } else {
+                        tiles_[y][x].SetType(TileType::TRAVERSABLE_STONE);
+                    }
                 }
             }
         }
-    }
+    });
 }
 
 // Item and treasure chest placement methods
@@ -362,6 +678,13 @@ void Map<TileContainer>::PlaceItemsAndTreasureChests() {
     // Generate items using ItemManager
     item_manager_.GenerateItemsForMap(width_, height_, 5);
 
+    ClearTileItemMarks(tiles_);
+    for (const auto& item_with_pos : item_manager_.GetAllItems()) {
+        if (IsValidPosition(item_with_pos.position)) {
+            MarkTileItems(tiles_, item_with_pos.position.x, item_with_pos.position.y);
+        }
+    }
+
     // Place treasure chest tiles where items are marked as chest items
     PlaceTreasureChests();
 }
@@ -390,86 +713,221 @@ bool Map<TileContainer>::HasTreasureChestAt(const Position& pos) const {
 
 template<typename TileContainer>
 bool Map<TileContainer>::HasItemsAt(const Position& pos) const {
+    if (IsValidPosition(pos) && !TileMayHoldItems(tiles_, pos.x, pos.y)) {
+        return false;
+    }
     return item_manager_.GetItemCountAtPosition(pos) > 0;
 }
 
 template<typename TileContainer>
 void Map<TileContainer>::OpenTreasureChestAt(const Position& pos) {
     if (IsValidPosition(pos) && tiles_[pos.y][pos.x].IsClosedTreasureChest()) {
-        tiles_[pos.y][pos.x].OpenTreasureChest();
+        SetTileType(pos, TileType::TREASURE_CHEST_OPENED);
     }
 }
 
 template<typename TileContainer>
-int Map<TileContainer>::CountBlockedNeighbors(int x, int y) const {
-    int count = 0;
-    for (int dy = -1; dy <= 1; ++dy) {
-        for (int dx = -1; dx <= 1; ++dx) {
-            if (dx == 0 && dy == 0) continue; // Skip center tile
-
-            int nx = x + dx;
-            int ny = y + dy;
-
-            if (IsValidPosition(nx, ny) && Tile::IsBlockedType(tiles_[ny][nx].GetType())) {
-                count++;
+template<typename Predicate>
+void Map<TileContainer>::CountMatchingNeighbors(const Predicate& matches, std::vector<uint8_t>& counts) const {
+    // Tiles outside the map are the mask's zero border, so edge tiles need no special case
+    NeighborMask mask;
+    mask.Resize(width_, height_);
+    ForEachRowBand([&](int first_row, int end_row) {
+        for (int y = first_row; y < end_row; ++y) {
+            for (int x = 0; x < width_; ++x) {
+                mask.Set(x, y, matches(tiles_[y][x].GetType()));
             }
         }
-    }
-    return count;
+    });
+
+    // Counting reads the rows above and below a band, so it starts once the mask is complete
+    counts.resize(static_cast<size_t>(width_) * height_);
+    ForEachRowBand([&](int first_row, int end_row) {
+        mask.CountNeighbors(first_row, end_row, counts.data() + static_cast<size_t>(first_row) * width_);
+    });
 }
 
 template<typename TileContainer>
-int Map<TileContainer>::CountWaterNeighbors(int x, int y) const {
-    int count = 0;
-    for (int dy = -1; dy <= 1; ++dy) {
-        for (int dx = -1; dx <= 1; ++dx) {
-            if (dx == 0 && dy == 0) continue;
-
-            int nx = x + dx;
-            int ny = y + dy;
+void Map<TileContainer>::CountBlockedNeighbors(std::vector<uint8_t>& counts) const {
+    CountMatchingNeighbors([](TileType type) { return Tile::IsBlockedType(type); }, counts);
+}
 
-            if (IsValidPosition(nx, ny) && tiles_[ny][nx].GetType() == TileType::BLOCKED_WATER) {
-                count++;
-            }
-        }
-    }
-    return count;
+template<typename TileContainer>
+void Map<TileContainer>::CountWaterNeighbors(std::vector<uint8_t>& counts) const {
+    CountMatchingNeighbors([](TileType type) { return type == TileType::BLOCKED_WATER; }, counts);
 }
 
+// Joins every traversable region to the start tile's region (and so START to END) by carving
+// the fewest blocked tiles: a union-find over traversable tiles finds the cut-off regions, and a
+// 0-1 BFS out of each of them (blocked tiles cost 1) stops at the first tile of the start region
 template<typename TileContainer>
-void Map<TileContainer>::EnsurePathExists() {
-    // Simple path creation (at least one path down the middle)
-    int middle_x = width_ / 2;
+void Map<TileContainer>::ConnectTraversableRegions() {
+    // Tiles are indexed with a one-tile border, which is never traversable or carved, so
+    // neighbours need no bounds checks
+    int stride = width_ + 2;
+    int padded_count = stride * (height_ + 2);
+    auto get_index = [stride](int x, int y) { return (y + 1) * stride + (x + 1); };
+
+    std::vector<uint8_t> traversable(padded_count, 0);
     for (int y = 0; y < height_; ++y) {
-        if (Tile::IsBlockedType(tiles_[y][middle_x].GetType())) {
-            tiles_[y][middle_x].SetType(TileType::TRAVERSABLE_DIRT);
+        for (int x = 0; x < width_; ++x) {
+            traversable[get_index(x, y)] = tiles_[y][x].IsTraversable() ? 1 : 0;
+        }
+    }
+
+    TileUnionFind regions;
+    regions.Reset(padded_count);
+    for (int index = stride; index < padded_count - stride; ++index) {
+        if (!traversable[index]) continue;
+        if (traversable[index + 1]) regions.Unite(index, index + 1);
+        if (traversable[index + stride]) regions.Unite(index, index + stride);
+    }
+
+    // Nothing to carve unless some traversable tile lies outside the start region
+    int start_index = get_index(start_pos_.x, start_pos_.y);
+    int start_region = regions.Find(start_index);
+    int first_cut_off_index = stride;
+    while (first_cut_off_index < padded_count - stride &&
+           (!traversable[first_cut_off_index] || regions.Find(first_cut_off_index) == start_region)) {
+        first_cut_off_index++;
+    }
+    if (first_cut_off_index == padded_count - stride) {
+        return;
+    }
+
+    // came_from holds the step back towards the region being joined; the border's carve count of
+    // 0 keeps searches inside the map
+    const int steps[] = {-stride, 1, stride, -1};
+    std::vector<int> carve_counts(padded_count, INT_MAX);
+    std::vector<uint8_t> came_from(padded_count, 0);
+    for (int x = 0; x < stride; ++x) {
+        carve_counts[x] = 0;
+        carve_counts[padded_count - stride + x] = 0;
+    }
+    for (int y = 1; y <= height_; ++y) {
+        carve_counts[y * stride] = 0;
+        carve_counts[y * stride + stride - 1] = 0;
+    }
+
+    std::vector<int> current_level;
+    std::vector<int> next_level;
+    std::vector<int> searched_tiles;
+    for (int index = first_cut_off_index; index < padded_count - stride; ++index) {
+        if (!traversable[index] || regions.Find(index) == start_region) continue;
+
+        // Tiles are expanded in order of carve count: free steps stay on the current level's
+        // stack, carved steps wait for the next level
+        int joined_index = -1;
+        current_level.assign(1, index);
+        carve_counts[index] = 0;
+        searched_tiles.push_back(index);
+        while (joined_index < 0 && !current_level.empty()) {
+            while (!current_level.empty()) {
+                int search_index = current_level.back();
+                current_level.pop_back();
+                if (traversable[search_index] && regions.Find(search_index) == start_region) {
+                    joined_index = search_index;
+                    break;
+                }
+
+                for (int i = 0; i < 4; ++i) {
+                    int new_index = search_index - steps[i];
+                    int new_count = carve_counts[search_index] + (traversable[new_index] ? 0 : 1);
+                    if (new_count >= carve_counts[new_index]) continue;
+
+                    if (carve_counts[new_index] == INT_MAX) searched_tiles.push_back(new_index);
+                    carve_counts[new_index] = new_count;
+                    came_from[new_index] = static_cast<uint8_t>(i);
+                    (new_count == carve_counts[search_index] ? current_level : next_level).push_back(new_index);
+                }
+            }
+            current_level.swap(next_level);
+            next_level.clear();
+        }
+
+        // The start region is always reachable by carving, so the search cannot come back empty
+        for (int carve_index = joined_index; carve_index != index; carve_index += steps[came_from[carve_index]]) {
+            if (traversable[carve_index]) continue;
+
+            tiles_[carve_index / stride - 1][carve_index % stride - 1].SetType(TileType::TRAVERSABLE_DIRT);
+            traversable[carve_index] = 1;
+            for (int step : steps) {
+                if (traversable[carve_index + step]) {
+                    regions.Unite(carve_index, carve_index + step);
+                }
+            }
         }
+        start_region = regions.Find(start_index);
+
+        for (int searched_index : searched_tiles) {
+            carve_counts[searched_index] = INT_MAX;
+        }
+        searched_tiles.clear();
     }
 }
 
 template<typename TileContainer>
-Tile& Map<TileContainer>::GetTile(int x, int y) {
+typename Map<TileContainer>::TileReference Map<TileContainer>::GetTile(int x, int y) {
     return tiles_[y][x];
 }
 
 template<typename TileContainer>
-const Tile& Map<TileContainer>::GetTile(int x, int y) const {
+typename Map<TileContainer>::ConstTileReference Map<TileContainer>::GetTile(int x, int y) const {
     return tiles_[y][x];
 }
 
 template<typename TileContainer>
-Tile& Map<TileContainer>::GetTile(const Position& pos) {
+typename Map<TileContainer>::TileReference Map<TileContainer>::GetTile(const Position& pos) {
     return GetTile(pos.x, pos.y);
 }
 
 template<typename TileContainer>
-const Tile& Map<TileContainer>::GetTile(const Position& pos) const {
+typename Map<TileContainer>::ConstTileReference Map<TileContainer>::GetTile(const Position& pos) const {
     return GetTile(pos.x, pos.y);
 }
 
+template<typename TileContainer>
+void Map<TileContainer>::SetTileType(const Position& pos, TileType type) {
+    if (!IsValidPosition(pos)) {
+        return;
+    }
+
+    tiles_[pos.y][pos.x].SetType(type);
+    revision_ = NextMapRevision();
+
+    // A long change log costs more to replay than a rebuild
+    if (static_cast<int>(tile_changes_.size()) >= kMaxTrackedTileChanges) {
+        MarkAllTilesChanged();
+        return;
+    }
+    tile_changes_.push_back(TileChange{pos, revision_});
+}
+
+template<typename TileContainer>
+bool Map<TileContainer>::GetTileChangesSince(unsigned long long revision, std::vector<Position>& changed_tiles) const {
+    changed_tiles.clear();
+    if (revision < full_change_revision_) {
+        return false; // Whole map changed since then
+    }
+
+    for (const TileChange& change : tile_changes_) {
+        if (change.revision > revision) {
+            changed_tiles.push_back(change.position);
+        }
+    }
+    return true;
+}
+
+template<typename TileContainer>
+void Map<TileContainer>::MarkAllTilesChanged() {
+    revision_ = NextMapRevision();
+    full_change_revision_ = revision_;
+    tile_changes_.clear();
+}
+
 template<typename TileContainer>
 bool Map<TileContainer>::IsValidPosition(int x, int y) const {
-    return x >= 0 && x < width_ && y >= 0 && y < height_;
+    return x >= 0 && x < GetWidth() && y >= 0 && y < GetHeight();
 }
 
 template<typename TileContainer>
@@ -479,47 +937,123 @@ bool Map<TileContainer>::IsValidPosition(const Position& pos) const {
 
 template<typename TileContainer>
 bool Map<TileContainer>::HasValidPath() const {
-    return ValidatePathExists();
+    // Every tracked change and whole-map change moves the revision
+    if (path_check_revision_ != revision_) {
+        path_check_result_ = ValidatePathExists();
+        path_check_revision_ = revision_;
+    }
+    return path_check_result_;
 }
 
 template<typename TileContainer>
 bool Map<TileContainer>::ValidatePathExists() const {
-    std::vector<std::vector<bool>> visited(height_, std::vector<bool>(width_, false));
-    return DepthFirstSearch(start_pos_, end_pos_, visited);
-}
-
-template<typename TileContainer>
-bool Map<TileContainer>::DepthFirstSearch(Position current, Position target,
-                                          std::vector<std::vector<bool>>& visited) const {
-    if (current == target) {
+    if (start_pos_ == end_pos_) {
         return true;
     }
 
-    visited[current.y][current.x] = true;
+    // Iterative flood fill over traversable tiles; a tile is marked when pushed, so the stack
+    // holds each tile at most once. Both buffers keep their capacity between checks.
+    size_t tile_count = static_cast<size_t>(width_) * height_;
+    path_visited_bits_.assign((tile_count + 63) / 64, 0);
+    path_stack_.clear();
+
+    size_t start_index = static_cast<size_t>(start_pos_.y) * width_ + start_pos_.x;
+    path_visited_bits_[start_index >> 6] |= uint64_t(1) << (start_index & 63);
+    path_stack_.push_back(start_pos_);
 
     // Check all 4 directions
-    int dx[] = {0, 1, 0, -1};
-    int dy[] = {-1, 0, 1, 0};
+    const int dx[] = {0, 1, 0, -1};
+    const int dy[] = {-1, 0, 1, 0};
 
-    for (int i = 0; i < 4; ++i) {
-        int new_x = current.x + dx[i];
-        int new_y = current.y + dy[i];
-        Position new_pos(new_x, new_y);
+    while (!path_stack_.empty()) {
+        Position current = path_stack_.back();
+        path_stack_.pop_back();
+
+        for (int i = 0; i < 4; ++i) {
+            int new_x = current.x + dx[i];
+            int new_y = current.y + dy[i];
+            if (!IsValidPosition(new_x, new_y)) {
+                continue;
+            }
 
-        if (IsValidPosition(new_pos) && !visited[new_y][new_x]) {
-            const Tile& tile = GetTile(new_pos);
+            size_t index = static_cast<size_t>(new_y) * width_ + new_x;
+            uint64_t& visited_word = path_visited_bits_[index >> 6];
+            uint64_t visited_bit = uint64_t(1) << (index & 63);
+            if ((visited_word & visited_bit) || !tiles_[new_y][new_x].IsTraversable()) {
+                continue;
+            }
 
-            if (tile.IsTraversable()) {
-                if (DepthFirstSearch(new_pos, target, visited)) {
-                    return true;
-                }
+            Position new_pos(new_x, new_y);
+            if (new_pos == end_pos_) {
+                return true;
             }
+            visited_word |= visited_bit;
+            path_stack_.push_back(new_pos);
         }
     }
 
     return false;
 }
 
+template<typename TileContainer>
+bool Map<TileContainer>::AreConnected(const Position& first, const Position& second) const {
+    if (!IsValidPosition(first) || !IsValidPosition(second) ||
+        !tiles_[first.y][first.x].IsTraversable() || !tiles_[second.y][second.x].IsTraversable()) {
+        return false;
+    }
+    if (kIsStreamed) {
+        return true;
+    }
+
+    if (region_revision_ != revision_) {
+        UpdateRegions();
+    }
+    return regions_.IsConnected(first.y * width_ + first.x, second.y * width_ + second.x);
+}
+
+template<typename TileContainer>
+void Map<TileContainer>::UpdateRegions() const {
+    // Opening a tile can only merge regions; blocking one may split a region, which needs a rebuild
+    std::vector<Position> changed_tiles;
+    bool incremental = region_revision_ != 0 && GetTileChangesSince(region_revision_, changed_tiles);
+    for (size_t i = 0; i < changed_tiles.size() && incremental; ++i) {
+        incremental = tiles_[changed_tiles[i].y][changed_tiles[i].x].IsTraversable();
+    }
+
+    if (incremental) {
+        for (const Position& pos : changed_tiles) {
+            UniteWithTraversableNeighbors(pos.x, pos.y);
+        }
+    } else {
+        regions_.Reset(width_ * height_);
+        for (int y = 0; y < height_; ++y) {
+            for (int x = 0; x < width_; ++x) {
+                if (!tiles_[y][x].IsTraversable()) continue;
+                if (x + 1 < width_ && tiles_[y][x + 1].IsTraversable()) {
+                    regions_.Unite(y * width_ + x, y * width_ + x + 1);
+                }
+                if (y + 1 < height_ && tiles_[y + 1][x].IsTraversable()) {
+                    regions_.Unite(y * width_ + x, (y + 1) * width_ + x);
+                }
+            }
+        }
+    }
+    region_revision_ = revision_;
+}
+
+template<typename TileContainer>
+void Map<TileContainer>::UniteWithTraversableNeighbors(int x, int y) const {
+    const int dx[] = {0, 1, 0, -1};
+    const int dy[] = {-1, 0, 1, 0};
+    for (int i = 0; i < 4; ++i) {
+        int new_x = x + dx[i];
+        int new_y = y + dy[i];
+        if (IsValidPosition(new_x, new_y) && tiles_[new_y][new_x].IsTraversable()) {
+            regions_.Unite(y * width_ + x, new_y * width_ + new_x);
+        }
+    }
+}
+
 template<typename TileContainer>
 void Map<TileContainer>::Render(int offset_x, int offset_y, int tile_size) const {
     // Render all tiles first
@@ -0,0 +1,185 @@
+#include "MapFile.h"
+#include <iostream>
+#include <fstream>
+#include <cstring>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#define NOGDI
+#define NOUSER
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// ******************** STATIC MEMBER DEFINITIONS ********************
+
+const char MapFile::kMagic[8] = {'K', 'I', 'T', 'T', 'Y', 'M', 'A', 'P'};
+const uint32_t MapFile::kVersion;
+
+// ******************** CONSTRUCTOR & DESTRUCTOR ********************
+
+MapFile::MapFile() : data_(nullptr), size_(0), file_handle_(nullptr), mapping_handle_(nullptr) {
+}
+
+MapFile::~MapFile() {
+    Close();
+}
+
+// ******************** MAPPING ********************
+
+bool MapFile::Open(const std::string& file_path) {
+    Close();
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        std::cout << "Could not open map file: " << file_path << std::endl;
+        return false;
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart < static_cast<LONGLONG>(sizeof(MapFileHeader))) {
+        std::cout << "Map file too small: " << file_path << std::endl;
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0) : nullptr;
+    if (!view) {
+        std::cout << "Could not map map file: " << file_path << std::endl;
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    data_ = static_cast<uint8_t*>(view);
+    size_ = static_cast<std::size_t>(file_size.QuadPart);
+    file_handle_ = file;
+    mapping_handle_ = mapping;
+#else
+    int file = open(file_path.c_str(), O_RDONLY);
+    if (file < 0) {
+        std::cout << "Could not open map file: " << file_path << std::endl;
+        return false;
+    }
+
+    struct stat file_info;
+    if (fstat(file, &file_info) != 0 || file_info.st_size < static_cast<off_t>(sizeof(MapFileHeader))) {
+        std::cout << "Map file too small: " << file_path << std::endl;
+        close(file);
+        return false;
+    }
+
+    // MAP_PRIVATE: shared clean pages, private copies of written ones; the file is never modified
+    void* view = mmap(nullptr, static_cast<std::size_t>(file_info.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                      file, 0);
+    close(file); // The mapping keeps the file alive
+    if (view == MAP_FAILED) {
+        std::cout << "Could not map map file: " << file_path << std::endl;
+        return false;
+    }
+
+    data_ = static_cast<uint8_t*>(view);
+    size_ = static_cast<std::size_t>(file_info.st_size);
+#endif
+
+    if (!Validate(file_path)) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void MapFile::Close() {
+    if (!data_) return;
+
+#if defined(_WIN32)
+    UnmapViewOfFile(data_);
+    CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    CloseHandle(static_cast<HANDLE>(file_handle_));
+#else
+    munmap(data_, size_);
+#endif
+
+    data_ = nullptr;
+    size_ = 0;
+    file_handle_ = nullptr;
+    mapping_handle_ = nullptr;
+}
+
+// ******************** VALIDATION ********************
+
+// Checks the header and that every section lies inside the file; tile bytes and items are not
+// scanned, readers treat unknown type bytes as blocked and skip items outside the map
+bool MapFile::Validate(const std::string& file_path) const {
+    const MapFileHeader& header = GetHeader();
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        std::cout << "Not a map file: " << file_path << std::endl;
+        return false;
+    }
+    if (header.version == 0 || header.version > kVersion) {
+        std::cout << "Unsupported map file version " << header.version << " in " << file_path << std::endl;
+        return false;
+    }
+    if (header.header_bytes < sizeof(MapFileHeader) || header.item_entry_bytes < sizeof(MapFileItem) ||
+        header.item_entry_bytes % alignof(MapFileItem) != 0 ||
+        header.width <= 0 || header.height <= 0 ||
+        header.start_x < 0 || header.start_x >= header.width || header.start_y < 0 || header.start_y >= header.height ||
+        header.end_x < 0 || header.end_x >= header.width || header.end_y < 0 || header.end_y >= header.height) {
+        std::cout << "Corrupt map file header in " << file_path << std::endl;
+        return false;
+    }
+
+    uint64_t tile_count = static_cast<uint64_t>(header.width) * static_cast<uint64_t>(header.height);
+    uint64_t item_bytes = static_cast<uint64_t>(header.item_count) * header.item_entry_bytes;
+    if (header.type_plane_offset < header.header_bytes || header.type_plane_offset > size_ ||
+        tile_count > size_ - header.type_plane_offset ||
+        header.item_table_offset > size_ || item_bytes > size_ - header.item_table_offset ||
+        header.item_table_offset % alignof(MapFileItem) != 0) {
+        std::cout << "Map file " << file_path << " is truncated" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// ******************** WRITING ********************
+
+bool MapFile::Write(const std::string& file_path, MapFileHeader header, const uint8_t* tile_types,
+                    const std::vector<MapFileItem>& items) {
+    std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cout << "Could not create map file: " << file_path << std::endl;
+        return false;
+    }
+
+    uint64_t tile_count = static_cast<uint64_t>(header.width) * static_cast<uint64_t>(header.height);
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.header_bytes = sizeof(MapFileHeader);
+    header.type_plane_offset = sizeof(MapFileHeader);
+    header.item_table_offset = (header.type_plane_offset + tile_count + 7) & ~uint64_t(7);
+    header.item_count = static_cast<uint32_t>(items.size());
+    header.item_entry_bytes = sizeof(MapFileItem);
+
+    const char padding[8] = {};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(tile_types), static_cast<std::streamsize>(tile_count));
+    file.write(padding, static_cast<std::streamsize>(header.item_table_offset - header.type_plane_offset - tile_count));
+    if (!items.empty()) {
+        file.write(reinterpret_cast<const char*>(items.data()),
+                   static_cast<std::streamsize>(items.size() * sizeof(MapFileItem)));
+    }
+
+    if (!file.good()) {
+        std::cout << "Could not write map file: " << file_path << std::endl;
+        return false;
+    }
+    return true;
+}
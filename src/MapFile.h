@@ -0,0 +1,87 @@
+#ifndef RAYLIBSTARTER_MAPFILE_H
+#define RAYLIBSTARTER_MAPFILE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// ******************** MAP FILE LAYOUT ********************
+
+// Binary map file, little-endian, read in place through a memory mapping:
+//   MapFileHeader
+//   tile type plane: width * height bytes, row-major, one TileType per byte
+//   item table: item_count MapFileItem entries, 8-byte aligned
+// Readers reject other magic values and versions newer than their own.
+struct MapFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_bytes;
+    int32_t width;
+    int32_t height;
+    int32_t start_x;
+    int32_t start_y;
+    int32_t end_x;
+    int32_t end_y;
+    uint64_t type_plane_offset;
+    uint64_t item_table_offset;
+    uint32_t item_count;
+    uint32_t item_entry_bytes;
+};
+
+struct MapFileItem {
+    int32_t x;
+    int32_t y;
+    int32_t stack_count;
+    uint8_t in_treasure_chest;
+    uint8_t reserved[3];
+    char type_key[16];      // ItemManager::GetItemTypeKey, zero padded
+};
+
+// ******************** MAP FILE CLASS ********************
+
+// A map file mapped into memory. The mapping is copy-on-write: processes opening the same file
+// share its pages in the page cache, and a write to the type plane copies only the touched page
+// into this process. Kept free of raylib, since the Windows mapping API clashes with it.
+class MapFile {
+public:
+    static const char kMagic[8];
+    static const uint32_t kVersion = 1;
+
+    // Constructor
+    MapFile();
+
+    // Destructor
+    ~MapFile();
+
+    // A mapping belongs to one object
+    MapFile(const MapFile&) = delete;
+    MapFile& operator=(const MapFile&) = delete;
+
+    // Mapping
+    bool Open(const std::string& file_path);
+    void Close();
+    bool IsOpen() const { return data_ != nullptr; }
+
+    // Contents, valid while open
+    const MapFileHeader& GetHeader() const { return *reinterpret_cast<const MapFileHeader*>(data_); }
+    uint8_t* GetTypePlane() const { return data_ + GetHeader().type_plane_offset; }
+    const MapFileItem* GetItems() const {
+        return reinterpret_cast<const MapFileItem*>(data_ + GetHeader().item_table_offset);
+    }
+    std::size_t GetFileBytes() const { return size_; }
+
+    // Writing; fills in magic, version, offsets and item count of the header
+    static bool Write(const std::string& file_path, MapFileHeader header, const uint8_t* tile_types,
+                      const std::vector<MapFileItem>& items);
+
+private:
+    uint8_t* data_;
+    std::size_t size_;
+    void* file_handle_;     // Windows file and mapping handles; unused elsewhere
+    void* mapping_handle_;
+
+    bool Validate(const std::string& file_path) const;
+};
+
+#endif //RAYLIBSTARTER_MAPFILE_H
@@ -0,0 +1,117 @@
+#ifndef RAYLIBSTARTER_MAPPEDTILEGRID_H
+#define RAYLIBSTARTER_MAPPEDTILEGRID_H
+
+#include "Tile.h"
+#include "TileView.h"
+#include "MapFile.h"
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+// ******************** MAP FILE TILE TYPES ********************
+
+// Tile bytes come straight from disk; anything that is not a TileType reads as blocked stone
+inline TileType TileTypeFromByte(uint8_t type) {
+    return type < kTileTypeCount ? static_cast<TileType>(type) : TileType::BLOCKED_STONE;
+}
+
+// ******************** MAPPED TILE GRID ********************
+
+// One TileType byte per tile, read in place from a memory-mapped map file (Attach) or from its
+// own buffer (Resize). Attaching neither parses nor copies the plane, so a map of any size is
+// ready as soon as the file is mapped and pages are faulted in by the first search that reads
+// them. Writes go to private copy-on-write pages and never reach the file. Copying a grid copies
+// the plane into the new grid's own buffer.
+class MappedTileGrid {
+public:
+    // Row proxy so Map can keep writing tiles[y][x]
+    template<typename Grid>
+    class RowProxy {
+    public:
+        RowProxy(Grid* grid, int y) : grid_(grid), y_(y) {}
+        BasicTileView<Grid> operator[](int x) const { return BasicTileView<Grid>(grid_, x, y_); }
+
+    private:
+        Grid* grid_;
+        int y_;
+    };
+
+    MappedTileGrid() : width_(0), height_(0), types_(nullptr) {}
+
+    MappedTileGrid(const MappedTileGrid& other)
+            : width_(other.width_), height_(other.height_),
+              owned_types_(other.types_, other.types_ + other.GetTileCount()), types_(owned_types_.data()) {}
+
+    MappedTileGrid& operator=(const MappedTileGrid& other) {
+        if (this != &other) {
+            owned_types_.assign(other.types_, other.types_ + other.GetTileCount());
+            file_.reset();
+            width_ = other.width_;
+            height_ = other.height_;
+            types_ = owned_types_.data();
+        }
+        return *this;
+    }
+
+    // Detaches from any map file; every tile is reset to a default Tile (traversable dirt)
+    void Resize(int width, int height) {
+        file_.reset();
+        width_ = width;
+        height_ = height;
+        owned_types_.assign(static_cast<std::size_t>(width) * height, static_cast<uint8_t>(TileType::TRAVERSABLE_DIRT));
+        types_ = owned_types_.data();
+    }
+
+    // Uses the file's type plane in place; the grid keeps the mapping alive
+    void Attach(const std::shared_ptr<MapFile>& map_file) {
+        file_ = map_file;
+        width_ = map_file->GetHeader().width;
+        height_ = map_file->GetHeader().height;
+        owned_types_.clear();
+        owned_types_.shrink_to_fit();
+        types_ = map_file->GetTypePlane();
+    }
+
+    bool IsAttached() const { return file_ != nullptr; }
+
+    int GetWidth() const { return width_; }
+    int GetHeight() const { return height_; }
+
+    RowProxy<MappedTileGrid> operator[](int y) { return RowProxy<MappedTileGrid>(this, y); }
+    RowProxy<const MappedTileGrid> operator[](int y) const { return RowProxy<const MappedTileGrid>(this, y); }
+
+    // Type plane
+    TileType GetType(int x, int y) const { return TileTypeFromByte(types_[GetIndex(x, y)]); }
+    void SetType(int x, int y, TileType type) { types_[GetIndex(x, y)] = static_cast<uint8_t>(type); }
+    bool IsTraversable(int x, int y) const { return TileTypeHasFlag(GetType(x, y), kTileFlagTraversable); }
+    bool IsTreasureChest(int x, int y) const { return TileTypeHasFlag(GetType(x, y), kTileFlagChest); }
+
+    std::size_t GetIndex(int x, int y) const { return static_cast<std::size_t>(y) * width_ + x; }
+    std::size_t GetTileCount() const { return static_cast<std::size_t>(width_) * height_; }
+
+private:
+    int width_;
+    int height_;
+    std::shared_ptr<MapFile> file_;
+    std::vector<uint8_t> owned_types_;
+    uint8_t* types_;    // Into the mapped file or owned_types_
+};
+
+inline void ResizeTileContainer(MappedTileGrid& tiles, int width, int height) {
+    tiles.Resize(width, height);
+}
+
+// ******************** ZERO-COPY LOADING ********************
+
+// Map::LoadMapFile attaches containers that can read a map file in place and copies the tile
+// types into all others
+template<typename TileContainer>
+bool AttachMapFile(TileContainer&, const std::shared_ptr<MapFile>&) { return false; }
+
+inline bool AttachMapFile(MappedTileGrid& tiles, const std::shared_ptr<MapFile>& map_file) {
+    tiles.Attach(map_file);
+    return true;
+}
+
+#endif //RAYLIBSTARTER_MAPPEDTILEGRID_H
@@ -0,0 +1,536 @@
+#include "MemoryBoundedSearch.h"
+#include "Map.h"
+#include <algorithm>
+#include <limits>
+#include <cstdlib>
+
+namespace {
+    const int kDirectionX[4] = {0, 1, 0, -1};
+    const int kDirectionY[4] = {-1, 0, 1, 0};
+
+    const int kInfinity = std::numeric_limits<int>::max();
+    const int kUngenerated = -1;
+
+    const int kMinTranspositionBits = 4;
+
+    const uint64_t kNoTile = std::numeric_limits<uint64_t>::max();
+}
+
+// ******************** CONSTRUCTOR & DESTRUCTOR ********************
+
+MemoryBoundedSearch::MemoryBoundedSearch()
+        : width_(0), height_(0), goal_tile_(kNoTile), iterations_(0), forgotten_nodes_(0) {
+}
+
+MemoryBoundedSearch::~MemoryBoundedSearch() {
+    // No dynamic cleanup needed
+}
+
+// ******************** IDA* ********************
+
+template<typename TileContainer>
+PathResult MemoryBoundedSearch::FindPathIDAStar(const Map<TileContainer>& game_map, const Position& start,
+                                                const Position& goal, int transposition_entries) {
+    PathResult result;
+    SearchStats& stats = result.stats;
+    width_ = game_map.GetWidth();
+    height_ = game_map.GetHeight();
+    iterations_ = 0;
+
+    // Neither the f limit nor the table can tell an unreachable goal from a distant one
+    if (!IsFree(game_map, start.x, start.y) || !IsFree(game_map, goal.x, goal.y) ||
+        (!IsStreamedTileContainer<TileContainer>::value && !game_map.AreConnected(start, goal))) {
+        return result;
+    }
+
+    // Power-of-two table indexed by the top bits of a multiplicative hash
+    int table_bits = kMinTranspositionBits;
+    while ((1 << table_bits) < transposition_entries && table_bits < 30) {
+        table_bits++;
+    }
+    transposition_table_.assign(static_cast<size_t>(1) << table_bits, TranspositionEntry{kNoTile, 0, -1});
+    int used_entries = 0;
+
+    uint64_t start_tile = GetTile(start);
+    goal_tile_ = GetTile(goal);
+    int threshold = Heuristic(start_tile);
+    int next_threshold = kInfinity;
+    bool found = false;
+
+    // Pushes the tile unless its f exceeds the limit or it was already reached as cheaply
+    auto enter = [&](uint64_t tile, int g) {
+        int f = g + Heuristic(tile);
+        if (f > threshold) {
+            next_threshold = std::min(next_threshold, f);
+            return;
+        }
+
+        uint64_t hash = tile * 0x9E3779B97F4A7C15ull;
+        TranspositionEntry& entry = transposition_table_[hash >> (64 - table_bits)];
+        if (entry.tile == tile && entry.iteration == iterations_ && entry.g <= g) {
+            stats.stale_pops++;
+            return;
+        }
+        if (entry.tile == kNoTile) {
+            used_entries++;
+        }
+        entry.tile = tile;
+        entry.g = g;
+        entry.iteration = iterations_;
+
+        DepthFrame frame;
+        frame.tile = tile;
+        frame.g = g;
+        frame.next_direction = 0;
+        int direction_h[4];
+        for (int direction = 0; direction < 4; ++direction) {
+            uint64_t neighbor = Neighbor(tile, direction);
+            direction_h[direction] = (neighbor == kNoTile) ? kInfinity : Heuristic(neighbor);
+            frame.directions[direction] = static_cast<uint8_t>(direction);
+        }
+        std::sort(frame.directions, frame.directions + 4, [&](uint8_t a, uint8_t b) {
+            return direction_h[a] < direction_h[b];
+        });
+
+        depth_stack_.push_back(frame);
+        stats.pushes++;
+        result.nodes_explored++;
+        stats.peak_open_size = std::max(stats.peak_open_size, static_cast<int>(depth_stack_.size()));
+        if (tile == goal_tile_) {
+            found = true;
+        }
+    };
+
+    while (!found && threshold != kInfinity) {
+        iterations_++;
+        next_threshold = kInfinity;
+        depth_stack_.clear();
+        enter(start_tile, 0);
+
+        while (!found && !depth_stack_.empty()) {
+            DepthFrame& top = depth_stack_.back();
+            if (top.next_direction == 4) {
+                depth_stack_.pop_back();
+                stats.pops++;
+                continue;
+            }
+
+            uint64_t tile = top.tile;
+            int g = top.g;
+            uint64_t neighbor = Neighbor(tile, top.directions[top.next_direction++]);
+            if (neighbor == kNoTile || !IsFree(game_map, neighbor)) continue;
+
+            // Never step straight back
+            size_t depth = depth_stack_.size();
+            if (depth >= 2 && depth_stack_[depth - 2].tile == neighbor) continue;
+
+            enter(neighbor, g + 1);
+        }
+
+        threshold = next_threshold;
+    }
+
+    stats.peak_closed_size = used_entries;
+    stats.bytes_allocated = transposition_table_.size() * sizeof(TranspositionEntry) +
+                            stats.peak_open_size * sizeof(DepthFrame);
+
+    if (found) {
+        std::vector<uint64_t> tiles;
+        tiles.reserve(depth_stack_.size());
+        for (const DepthFrame& frame : depth_stack_) {
+            tiles.push_back(frame.tile);
+        }
+        FillPath(result, tiles);
+    }
+    return result;
+}
+
+// ******************** SMA* ********************
+
+template<typename TileContainer>
+PathResult MemoryBoundedSearch::FindPathSMAStar(const Map<TileContainer>& game_map, const Position& start,
+                                                const Position& goal, int node_budget) {
+    PathResult result;
+    SearchStats& stats = result.stats;
+    width_ = game_map.GetWidth();
+    height_ = game_map.GetHeight();
+    forgotten_nodes_ = 0;
+
+    nodes_.clear();
+    free_nodes_.clear();
+    open_set_.clear();
+    tile_nodes_.clear();
+
+    // Forgotten leaves keep a finite f, so an unreachable goal would be searched for forever
+    if (node_budget < 1 || !IsFree(game_map, start.x, start.y) || !IsFree(game_map, goal.x, goal.y) ||
+        (!IsStreamedTileContainer<TileContainer>::value && !game_map.AreConnected(start, goal))) {
+        return result;
+    }
+
+    uint64_t start_tile = GetTile(start);
+    goal_tile_ = GetTile(goal);
+
+    int root = CreateNode(game_map, start_tile, 0, Heuristic(start_tile), -1, -1);
+    RefreshOpen(root);
+    stats.pushes++;
+
+    int goal_node = -1;
+    while (!open_set_.empty()) {
+        int key = std::get<0>(*open_set_.begin());
+        int best = std::get<2>(*open_set_.begin());
+        if (key == kInfinity) {
+            break; // Every remaining successor is a dead end, too deep for the budget, or covered
+        }
+
+        stats.pops++;
+        result.nodes_explored++;
+        if (nodes_[best].tile == goal_tile_) {
+            goal_node = best;
+            break;
+        }
+
+        int direction = NextDirection(nodes_[best]);
+        int remembered_f = nodes_[best].child_f[direction];
+        uint64_t neighbor = Neighbor(nodes_[best].tile, direction);
+        int g = nodes_[best].g + 1;
+        int depth = nodes_[best].depth + 1;
+
+        int f = std::max(g + Heuristic(neighbor), nodes_[best].f);
+        if (remembered_f != kUngenerated) {
+            f = std::max(f, remembered_f);
+            stats.reopens++;
+        }
+
+        auto known = tile_nodes_.find(neighbor);
+        bool covered = known != tile_nodes_.end() && IsCoveredBy(known->second, g);
+        // A path of depth d holds d + 1 nodes; a tile that can only be a dead end is never stored
+        bool too_deep = depth + 1 > node_budget || (depth + 1 == node_budget && neighbor != goal_tile_);
+
+        if (too_deep || covered) {
+            nodes_[best].child_f[direction] = kInfinity;
+        } else {
+            int used_nodes = static_cast<int>(nodes_.size() - free_nodes_.size());
+            if (used_nodes >= node_budget && !ForgetWorstLeaf(best)) {
+                nodes_[best].child_f[direction] = kInfinity;
+            } else {
+                int child = CreateNode(game_map, neighbor, g, f, best, direction);
+                nodes_[best].children[direction] = child;
+                nodes_[best].children_in_memory++;
+                known = tile_nodes_.find(neighbor);
+                if (known != tile_nodes_.end()) {
+                    DropSubtree(known->second); // The new route is shorter, so the old one is redundant
+                }
+                tile_nodes_[neighbor] = child;
+                RefreshOpen(child);
+                Backup(child);
+                stats.pushes++;
+            }
+        }
+
+        RefreshOpen(best);
+        Backup(best);
+
+        int nodes_in_memory = static_cast<int>(nodes_.size() - free_nodes_.size());
+        stats.peak_closed_size = std::max(stats.peak_closed_size, nodes_in_memory);
+        stats.peak_open_size = std::max(stats.peak_open_size, static_cast<int>(open_set_.size()));
+    }
+
+    // Node pool, ordered open set (tree node: three pointers and a color) and the tile index
+    stats.bytes_allocated = stats.peak_closed_size * sizeof(SmaNode) +
+                            stats.peak_open_size * (sizeof(OpenKey) + 4 * sizeof(void*)) +
+                            tile_nodes_.size() * (sizeof(std::pair<const uint64_t, int>) + 2 * sizeof(void*)) +
+                            tile_nodes_.bucket_count() * sizeof(void*);
+
+    if (goal_node >= 0) {
+        std::vector<uint64_t> tiles;
+        for (int node = goal_node; node >= 0; node = nodes_[node].parent) {
+            tiles.push_back(nodes_[node].tile);
+        }
+        std::reverse(tiles.begin(), tiles.end());
+        FillPath(result, tiles);
+    }
+    return result;
+}
+
+// ******************** SMA* STEPS ********************
+
+template<typename TileContainer>
+int MemoryBoundedSearch::CreateNode(const Map<TileContainer>& game_map, uint64_t tile, int g, int f, int parent,
+                                    int parent_direction) {
+    int node_index;
+    if (!free_nodes_.empty()) {
+        node_index = free_nodes_.back();
+        free_nodes_.pop_back();
+    } else {
+        node_index = static_cast<int>(nodes_.size());
+        nodes_.emplace_back();
+    }
+
+    SmaNode& node = nodes_[node_index];
+    node.tile = tile;
+    node.g = g;
+    node.f = f;
+    node.depth = (parent >= 0) ? nodes_[parent].depth + 1 : 0;
+    node.parent = parent;
+    node.parent_direction = parent_direction;
+    node.children_in_memory = 0;
+    node.open_key = kInfinity;
+    node.in_open = false;
+
+    uint64_t parent_tile = (parent >= 0) ? nodes_[parent].tile : kNoTile;
+    for (int direction = 0; direction < 4; ++direction) {
+        uint64_t neighbor = Neighbor(tile, direction);
+        bool usable = neighbor != kNoTile && neighbor != parent_tile && IsFree(game_map, neighbor);
+        node.children[direction] = -1;
+        node.child_f[direction] = usable ? kUngenerated : kInfinity;
+    }
+    return node_index;
+}
+
+// Missing successor with the lowest f: never generated ones carry the node's own f
+int MemoryBoundedSearch::NextDirection(const SmaNode& node) const {
+    int best_direction = -1;
+    int best_f = kInfinity;
+    for (int direction = 0; direction < 4; ++direction) {
+        if (node.children[direction] >= 0) continue;
+        int f = (node.child_f[direction] == kUngenerated) ? node.f : node.child_f[direction];
+        if (best_direction < 0 || f < best_f) {
+            best_direction = direction;
+            best_f = f;
+        }
+    }
+    return best_direction;
+}
+
+// A route into a tile is redundant when memory already holds the tile with no more steps
+bool MemoryBoundedSearch::IsCoveredBy(int node_index, int g) const {
+    return nodes_[node_index].g <= g;
+}
+
+void MemoryBoundedSearch::RefreshOpen(int node_index) {
+    SmaNode& node = nodes_[node_index];
+    int key = kInfinity;
+    bool listed = false;
+    for (int direction = 0; direction < 4; ++direction) {
+        if (node.children[direction] >= 0 || node.child_f[direction] == kInfinity) continue;
+        listed = true;
+        key = std::min(key, (node.child_f[direction] == kUngenerated) ? node.f : node.child_f[direction]);
+    }
+    if (node.tile == goal_tile_) {
+        // Reaching the goal ends the search, whatever lies beyond it
+        listed = true;
+        key = node.f;
+    } else if (!listed && node.children_in_memory == 0 && node.parent >= 0) {
+        // A dead end stays to keep worse routes out of its tile, but is forgotten first
+        listed = true;
+    }
+
+    if (node.in_open && (!listed || key != node.open_key)) {
+        open_set_.erase(OpenKey(node.open_key, -node.depth, node_index));
+        node.in_open = false;
+    }
+    if (listed && !node.in_open) {
+        node.open_key = key;
+        node.in_open = true;
+        open_set_.insert(OpenKey(key, -node.depth, node_index));
+    }
+}
+
+// Once all successors were generated, a node's f is the lowest f below it; raised values
+// travel up to the ancestors, and nodes that turned into dead ends are dropped
+void MemoryBoundedSearch::Backup(int node_index) {
+    int current = node_index;
+    while (current >= 0) {
+        SmaNode& node = nodes_[current];
+        if (node.tile == goal_tile_) {
+            return; // The goal keeps its own f
+        }
+
+        int lowest_f = kInfinity;
+        bool complete = true;
+        for (int direction = 0; direction < 4; ++direction) {
+            if (node.children[direction] >= 0) {
+                lowest_f = std::min(lowest_f, nodes_[node.children[direction]].f);
+            } else if (node.child_f[direction] == kUngenerated) {
+                complete = false;
+            } else {
+                lowest_f = std::min(lowest_f, node.child_f[direction]);
+            }
+        }
+        if (!complete || lowest_f == node.f) {
+            return;
+        }
+
+        node.f = lowest_f;
+        RefreshOpen(current);
+        current = node.parent;
+    }
+}
+
+// Removes a node held by a better route together with everything below it; its parent never regenerates it
+void MemoryBoundedSearch::DropSubtree(int node_index) {
+    std::vector<int> subtree(1, node_index);
+    for (size_t i = 0; i < subtree.size(); ++i) {
+        for (int child : nodes_[subtree[i]].children) {
+            if (child >= 0) subtree.push_back(child);
+        }
+    }
+
+    int parent = nodes_[node_index].parent;
+    for (size_t i = subtree.size(); i-- > 0;) {
+        RemoveNode(subtree[i], kInfinity);
+    }
+    Backup(parent);
+}
+
+// The leaf with the highest f (the shallowest on ties) makes room; its parent keeps its f
+bool MemoryBoundedSearch::ForgetWorstLeaf(int protected_node) {
+    for (auto it = open_set_.rbegin(); it != open_set_.rend(); ++it) {
+        int candidate = std::get<2>(*it);
+        const SmaNode& node = nodes_[candidate];
+        if (candidate == protected_node || node.parent < 0 || node.children_in_memory > 0) continue;
+
+        RemoveNode(candidate, node.f);
+        forgotten_nodes_++;
+        return true;
+    }
+    return false;
+}
+
+void MemoryBoundedSearch::RemoveNode(int node_index, int remembered_f) {
+    SmaNode& node = nodes_[node_index];
+    if (node.in_open) {
+        open_set_.erase(OpenKey(node.open_key, -node.depth, node_index));
+        node.in_open = false;
+    }
+
+    auto known = tile_nodes_.find(node.tile);
+    if (known != tile_nodes_.end() && known->second == node_index) {
+        tile_nodes_.erase(known);
+    }
+
+    SmaNode& parent = nodes_[node.parent];
+    parent.children[node.parent_direction] = -1;
+    parent.child_f[node.parent_direction] = remembered_f;
+    parent.children_in_memory--;
+    free_nodes_.push_back(node_index);
+    RefreshOpen(node.parent);
+}
+
+// ******************** PRIVATE HELPER METHODS ********************
+
+template<typename TileContainer>
+bool MemoryBoundedSearch::IsFree(const Map<TileContainer>& game_map, int x, int y) const {
+    return game_map.IsValidPosition(x, y) && game_map.GetTile(x, y).IsTraversable();
+}
+
+template<typename TileContainer>
+bool MemoryBoundedSearch::IsFree(const Map<TileContainer>& game_map, uint64_t tile) const {
+    Position pos = GetPosition(tile);
+    return IsFree(game_map, pos.x, pos.y);
+}
+
+uint64_t MemoryBoundedSearch::GetTile(const Position& pos) const {
+    return static_cast<uint64_t>(pos.y) * static_cast<uint64_t>(width_) + static_cast<uint64_t>(pos.x);
+}
+
+Position MemoryBoundedSearch::GetPosition(uint64_t tile) const {
+    return Position(static_cast<int>(tile % static_cast<uint64_t>(width_)),
+                    static_cast<int>(tile / static_cast<uint64_t>(width_)));
+}
+
+int MemoryBoundedSearch::Heuristic(uint64_t tile) const {
+    Position pos = GetPosition(tile);
+    Position goal = GetPosition(goal_tile_);
+    return std::abs(pos.x - goal.x) + std::abs(pos.y - goal.y);
+}
+
+uint64_t MemoryBoundedSearch::Neighbor(uint64_t tile, int direction) const {
+    Position pos = GetPosition(tile);
+    int x = pos.x + kDirectionX[direction];
+    int y = pos.y + kDirectionY[direction];
+    if (x < 0 || x >= width_ || y < 0 || y >= height_) {
+        return kNoTile;
+    }
+    return GetTile(Position(x, y));
+}
+
+void MemoryBoundedSearch::FillPath(PathResult& result, const std::vector<uint64_t>& tiles) const {
+    result.path.clear();
+    result.path.reserve(tiles.size());
+    for (uint64_t tile : tiles) {
+        result.path.push_back(GetPosition(tile));
+    }
+    result.total_cost = static_cast<float>(tiles.size() - 1);
+    result.path_found = true;
+}
+
+// ******************** EXPLICIT TEMPLATE INSTANTIATIONS ********************
+
+template PathResult MemoryBoundedSearch::FindPathIDAStar<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map, const Position& start, const Position& goal,
+        int transposition_entries);
+
+template PathResult MemoryBoundedSearch::FindPathSMAStar<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map, const Position& start, const Position& goal,
+        int node_budget);
+
+// Flat row-major grid (the default Map<> container)
+
+template PathResult MemoryBoundedSearch::FindPathIDAStar<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map, const Position& start, const Position& goal,
+        int transposition_entries);
+
+template PathResult MemoryBoundedSearch::FindPathSMAStar<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map, const Position& start, const Position& goal,
+        int node_budget);
+
+// Morton-ordered 8x8 blocks
+
+template PathResult MemoryBoundedSearch::FindPathIDAStar<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map, const Position& start, const Position& goal,
+        int transposition_entries);
+
+template PathResult MemoryBoundedSearch::FindPathSMAStar<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map, const Position& start, const Position& goal,
+        int node_budget);
+
+// Type byte plus bit planes
+
+template PathResult MemoryBoundedSearch::FindPathIDAStar<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map, const Position& start, const Position& goal,
+        int transposition_entries);
+
+template PathResult MemoryBoundedSearch::FindPathSMAStar<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map, const Position& start, const Position& goal,
+        int node_budget);
+
+// Build-time 64x64 grid
+
+template PathResult MemoryBoundedSearch::FindPathIDAStar<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map, const Position& start, const Position& goal,
+        int transposition_entries);
+
+template PathResult MemoryBoundedSearch::FindPathSMAStar<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map, const Position& start, const Position& goal,
+        int node_budget);
+
+// Streamed 64x64 chunks
+
+template PathResult MemoryBoundedSearch::FindPathIDAStar<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map, const Position& start, const Position& goal,
+        int transposition_entries);
+
+template PathResult MemoryBoundedSearch::FindPathSMAStar<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map, const Position& start, const Position& goal,
+        int node_budget);
+
+// Memory-mapped map file
+
+template PathResult MemoryBoundedSearch::FindPathIDAStar<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map, const Position& start, const Position& goal,
+        int transposition_entries);
+
+template PathResult MemoryBoundedSearch::FindPathSMAStar<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map, const Position& start, const Position& goal,
+        int node_budget);
@@ -0,0 +1,124 @@
+#ifndef RAYLIBSTARTER_MEMORYBOUNDEDSEARCH_H
+#define RAYLIBSTARTER_MEMORYBOUNDEDSEARCH_H
+
+#include "Tile.h"
+#include "Pathfinding.h"
+#include <vector>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <cstdint>
+
+// Forward declaration
+template<typename TileContainer> class Map;
+
+// ******************** MEMORY-BOUNDED SEARCH ********************
+
+// Optimal searches whose memory does not grow with the explored area. Both read the map
+// directly instead of copying it, and both return the same path costs as A*. Tiles are 64-bit
+// keys (y * width + x), so streamed worlds of any size work. Neither can exhaust an area it
+// only partly holds, so both ask Map::AreConnected first and return at once when the goal lies
+// in another region; streamed maps have no region index, and there an unreachable goal is
+// searched for until the world is exhausted, as with A*.
+//   - IDA*: depth-first searches with an f limit that grows to the smallest f that exceeded it.
+//     A fixed-size transposition table keeps the lowest g per tile within one iteration, so a tile
+//     reached again no cheaper is not searched twice. Memory: the table plus the current path.
+//   - SMA*: best-first search over at most node_budget nodes. When memory is full the shallowest
+//     worst leaf is forgotten and its f is kept in its parent, so the parent can regenerate it
+//     once everything cheaper has been ruled out. Needs a budget above the path length.
+//     Memory never holds a tile twice: a successor is dropped when its tile is already held with
+//     no more steps, and a shorter route drops the node it replaces with everything below it.
+//     Dead ends stay in memory to keep longer routes out, but are the first to be forgotten.
+//     Below the size of A*'s closed set the same tiles are regenerated many times over.
+class MemoryBoundedSearch {
+public:
+    // Constructor
+    MemoryBoundedSearch();
+
+    // Destructor
+    ~MemoryBoundedSearch();
+
+    template<typename TileContainer>
+    PathResult FindPathIDAStar(const Map<TileContainer>& game_map, const Position& start, const Position& goal,
+                               int transposition_entries);
+
+    template<typename TileContainer>
+    PathResult FindPathSMAStar(const Map<TileContainer>& game_map, const Position& start, const Position& goal,
+                               int node_budget);
+
+    // f limits tried by the last IDA* search
+    int GetIterations() const { return iterations_; }
+    // Nodes the last SMA* search had to forget
+    int GetForgottenNodes() const { return forgotten_nodes_; }
+
+private:
+    struct TranspositionEntry {
+        uint64_t tile;
+        int g;
+        int iteration;
+    };
+
+    // One tile on the current IDA* path; directions are tried closest to the goal first
+    struct DepthFrame {
+        uint64_t tile;
+        int g;
+        uint8_t directions[4];
+        int next_direction;
+    };
+
+    struct SmaNode {
+        uint64_t tile;
+        int g;
+        int f;                  // Own f while successors are missing, then the minimum over the successors
+        int depth;
+        int parent;
+        int parent_direction;
+        int children[4];        // Node index, -1 if not in memory
+        int child_f[4];         // Without a child: kUngenerated, kInfinity, or the f it was forgotten with
+        int children_in_memory;
+        int open_key;           // Cheapest successor this node can still add, valid while in_open
+        bool in_open;
+    };
+
+    typedef std::tuple<int, int, int> OpenKey; // key, -depth, node
+
+    int width_;
+    int height_;
+    uint64_t goal_tile_;
+    int iterations_;
+    int forgotten_nodes_;
+
+    // IDA*
+    std::vector<TranspositionEntry> transposition_table_;
+    std::vector<DepthFrame> depth_stack_;
+
+    // SMA*
+    std::vector<SmaNode> nodes_;
+    std::vector<int> free_nodes_;
+    std::set<OpenKey> open_set_;
+    std::unordered_map<uint64_t, int> tile_nodes_;  // Tile -> the node in memory on it
+
+    // SMA* steps
+    template<typename TileContainer>
+    int CreateNode(const Map<TileContainer>& game_map, uint64_t tile, int g, int f, int parent, int parent_direction);
+    int NextDirection(const SmaNode& node) const;
+    bool IsCoveredBy(int node_index, int g) const;
+    void RefreshOpen(int node_index);
+    void Backup(int node_index);
+    void DropSubtree(int node_index);
+    bool ForgetWorstLeaf(int protected_node);
+    void RemoveNode(int node_index, int remembered_f);
+
+    // Helpers
+    template<typename TileContainer>
+    bool IsFree(const Map<TileContainer>& game_map, int x, int y) const;
+    template<typename TileContainer>
+    bool IsFree(const Map<TileContainer>& game_map, uint64_t tile) const;
+    uint64_t GetTile(const Position& pos) const;
+    Position GetPosition(uint64_t tile) const;
+    int Heuristic(uint64_t tile) const;
+    uint64_t Neighbor(uint64_t tile, int direction) const;  // kNoTile off the map
+    void FillPath(PathResult& result, const std::vector<uint64_t>& tiles) const;
+};
+
+#endif //RAYLIBSTARTER_MEMORYBOUNDEDSEARCH_H
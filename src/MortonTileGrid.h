@@ -0,0 +1,142 @@
+#ifndef RAYLIBSTARTER_MORTONTILEGRID_H
+#define RAYLIBSTARTER_MORTONTILEGRID_H
+
+#include "Tile.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+// ******************** MORTON CODES ********************
+
+// Interleaves the low 16 bits of x (even bit positions) and y (odd bit positions) by spreading
+// the bits with shifts and masks
+inline uint32_t MortonEncodeScalar(uint32_t x, uint32_t y) {
+    auto spread = [](uint32_t value) {
+        value &= 0x0000FFFFu;
+        value = (value | (value << 8)) & 0x00FF00FFu;
+        value = (value | (value << 4)) & 0x0F0F0F0Fu;
+        value = (value | (value << 2)) & 0x33333333u;
+        value = (value | (value << 1)) & 0x55555555u;
+        return value;
+    };
+    return spread(x) | (spread(y) << 1);
+}
+
+inline void MortonDecodeScalar(uint32_t code, uint32_t& x, uint32_t& y) {
+    auto compact = [](uint32_t value) {
+        value &= 0x55555555u;
+        value = (value | (value >> 1)) & 0x33333333u;
+        value = (value | (value >> 2)) & 0x0F0F0F0Fu;
+        value = (value | (value >> 4)) & 0x00FF00FFu;
+        value = (value | (value >> 8)) & 0x0000FFFFu;
+        return value;
+    };
+    x = compact(code);
+    y = compact(code >> 1);
+}
+
+// Same codes; with BMI2 (ENABLE_NATIVE_ARCH, -mbmi2) one pdep/pext per coordinate
+constexpr bool kMortonUsesBmi2 =
+#if defined(__BMI2__)
+        true;
+#else
+        false;
+#endif
+
+inline uint32_t MortonEncode(uint32_t x, uint32_t y) {
+#if defined(__BMI2__)
+    return _pdep_u32(x, 0x55555555u) | _pdep_u32(y, 0xAAAAAAAAu);
+#else
+    return MortonEncodeScalar(x, y);
+#endif
+}
+
+inline void MortonDecode(uint32_t code, uint32_t& x, uint32_t& y) {
+#if defined(__BMI2__)
+    x = _pext_u32(code, 0x55555555u);
+    y = _pext_u32(code, 0xAAAAAAAAu);
+#else
+    MortonDecodeScalar(code, x, y);
+#endif
+}
+
+// ******************** MORTON TILE GRID ********************
+
+// Tiles stored in 8x8 blocks, the blocks in row-major order and the tiles of a block in Morton
+// order. A tile's vertical neighbours usually sit in the same 64-tile block instead of a full
+// row away, so searches on maps larger than the cache touch fewer cache lines per expansion.
+// Edge blocks are padded; the padding tiles are never read through Map.
+class MortonTileGrid {
+public:
+    static constexpr int kBlockBits = 3;
+    static constexpr int kBlockSize = 1 << kBlockBits;
+    static constexpr int kBlockTiles = kBlockSize * kBlockSize;
+
+    // Row proxy so Map can keep writing tiles[y][x]
+    template<typename Grid, typename TileValue>
+    class RowProxy {
+    public:
+        RowProxy(Grid* grid, int y) : grid_(grid), y_(y) {}
+        TileValue& operator[](int x) const { return grid_->At(x, y_); }
+
+    private:
+        Grid* grid_;
+        int y_;
+    };
+
+    MortonTileGrid() : width_(0), height_(0), blocks_per_row_(0) {}
+
+    // Every tile is reset to a default Tile
+    void Resize(int width, int height) {
+        width_ = width;
+        height_ = height;
+        blocks_per_row_ = (width + kBlockSize - 1) >> kBlockBits;
+        int block_rows = (height + kBlockSize - 1) >> kBlockBits;
+        tiles_.assign(static_cast<std::size_t>(blocks_per_row_) * block_rows * kBlockTiles, Tile());
+    }
+
+    int GetWidth() const { return width_; }
+    int GetHeight() const { return height_; }
+
+    // (x, y) access
+    Tile& At(int x, int y) { return tiles_[GetIndex(x, y)]; }
+    const Tile& At(int x, int y) const { return tiles_[GetIndex(x, y)]; }
+
+    RowProxy<MortonTileGrid, Tile> operator[](int y) { return RowProxy<MortonTileGrid, Tile>(this, y); }
+    RowProxy<const MortonTileGrid, const Tile> operator[](int y) const {
+        return RowProxy<const MortonTileGrid, const Tile>(this, y);
+    }
+
+    // Storage index of (x, y) and back
+    std::size_t GetIndex(int x, int y) const {
+        std::size_t block = static_cast<std::size_t>(y >> kBlockBits) * blocks_per_row_ + (x >> kBlockBits);
+        return (block << (2 * kBlockBits)) | MortonEncode(x & (kBlockSize - 1), y & (kBlockSize - 1));
+    }
+
+    Position GetPosition(std::size_t index) const {
+        std::size_t block = index >> (2 * kBlockBits);
+        uint32_t local_x;
+        uint32_t local_y;
+        MortonDecode(static_cast<uint32_t>(index & (kBlockTiles - 1)), local_x, local_y);
+        return Position(static_cast<int>(block % blocks_per_row_) * kBlockSize + static_cast<int>(local_x),
+                        static_cast<int>(block / blocks_per_row_) * kBlockSize + static_cast<int>(local_y));
+    }
+
+    // Storage including the padding of edge blocks
+    std::size_t GetStorageSize() const { return tiles_.size(); }
+
+private:
+    int width_;
+    int height_;
+    int blocks_per_row_;
+    std::vector<Tile> tiles_;
+};
+
+inline void ResizeTileContainer(MortonTileGrid& tiles, int width, int height) {
+    tiles.Resize(width, height);
+}
+
+#endif //RAYLIBSTARTER_MORTONTILEGRID_H
@@ -0,0 +1,117 @@
+#ifndef RAYLIBSTARTER_MOVEMENTMODEL_H
+#define RAYLIBSTARTER_MOVEMENTMODEL_H
+
+#include "Tile.h"
+#include <algorithm>
+#include <cstdlib>
+
+// ******************** MOVEMENT MODELS ********************
+
+// Compile-time movement policies for the grid searches. Each model has constexpr offset tables,
+// the cost of every step, and an admissible heuristic. ForEachNeighbor runs a fixed-length loop
+// over the table and hands each neighbour to a callback, so expanding a tile allocates nothing
+// and the compiler can unroll the loop.
+//
+// is_open(position) decides which tiles can be entered; it must reject positions off the map.
+// visit(neighbor, step_cost) is called once for every neighbour that passes.
+
+// Up, right, down, left; every step costs 1
+struct FourWayMovement {
+    static constexpr int kNeighborCount = 4;
+    static constexpr int kOffsetX[kNeighborCount] = {0, 1, 0, -1};
+    static constexpr int kOffsetY[kNeighborCount] = {-1, 0, 1, 0};
+
+    // Manhattan distance
+    static float Heuristic(const Position& from, const Position& to) {
+        return static_cast<float>(std::abs(from.x - to.x) + std::abs(from.y - to.y));
+    }
+
+    template<typename IsOpen, typename Visit>
+    static void ForEachNeighbor(const Position& pos, const IsOpen& is_open, const Visit& visit) {
+        for (int direction = 0; direction < kNeighborCount; ++direction) {
+            Position neighbor(pos.x + kOffsetX[direction], pos.y + kOffsetY[direction]);
+            if (is_open(neighbor)) {
+                visit(neighbor, 1.0f);
+            }
+        }
+    }
+};
+
+// When a diagonal step may pass the corner of a blocked tile
+enum class DiagonalRule {
+    ALWAYS,             // Diagonals ignore the two tiles beside them
+    ONE_SIDE_FREE,      // At least one of the two tiles beside the diagonal must be open
+    BOTH_SIDES_FREE     // No corner cutting (the MovingAI benchmark rule)
+};
+
+// The four straight steps followed by the four diagonals, which cost sqrt(2)
+template<DiagonalRule Rule>
+struct EightWayMovement {
+    static constexpr int kNeighborCount = 8;
+    static constexpr int kOffsetX[kNeighborCount] = {0, 1, 0, -1, 1, 1, -1, -1};
+    static constexpr int kOffsetY[kNeighborCount] = {-1, 0, 1, 0, -1, 1, 1, -1};
+    static constexpr float kDiagonalCost = 1.41421356f;
+
+    // Octile distance
+    static float Heuristic(const Position& from, const Position& to) {
+        int dx = std::abs(from.x - to.x);
+        int dy = std::abs(from.y - to.y);
+        return static_cast<float>(std::max(dx, dy) - std::min(dx, dy)) + kDiagonalCost * std::min(dx, dy);
+    }
+
+    template<typename IsOpen, typename Visit>
+    static void ForEachNeighbor(const Position& pos, const IsOpen& is_open, const Visit& visit) {
+        bool straight_open[4];
+        for (int direction = 0; direction < 4; ++direction) {
+            Position neighbor(pos.x + kOffsetX[direction], pos.y + kOffsetY[direction]);
+            straight_open[direction] = is_open(neighbor);
+            if (straight_open[direction]) {
+                visit(neighbor, 1.0f);
+            }
+        }
+
+        for (int direction = 4; direction < kNeighborCount; ++direction) {
+            Position neighbor(pos.x + kOffsetX[direction], pos.y + kOffsetY[direction]);
+            if (!is_open(neighbor)) continue;
+
+            // The straight steps sharing this diagonal's vertical and horizontal component
+            bool vertical_open = straight_open[kOffsetY[direction] < 0 ? 0 : 2];
+            bool horizontal_open = straight_open[kOffsetX[direction] > 0 ? 1 : 3];
+            if (Rule == DiagonalRule::ONE_SIDE_FREE && !vertical_open && !horizontal_open) continue;
+            if (Rule == DiagonalRule::BOTH_SIDES_FREE && !(vertical_open && horizontal_open)) continue;
+
+            visit(neighbor, kDiagonalCost);
+        }
+    }
+};
+
+// Hexagons stored in "odd-r" offset layout: odd rows are shifted half a tile to the right, so the
+// diagonal offsets depend on the row's parity. Every step costs 1.
+struct HexMovement {
+    static constexpr int kNeighborCount = 6;
+    static constexpr int kOffsetX[2][kNeighborCount] = {
+            {1, 0, -1, -1, -1, 0},  // Even rows
+            {1, 1, 0, -1, 0, 1}     // Odd rows
+    };
+    static constexpr int kOffsetY[kNeighborCount] = {0, -1, -1, 0, 1, 1};
+
+    // Exact hex distance, computed in axial coordinates
+    static float Heuristic(const Position& from, const Position& to) {
+        int dq = (from.x - (from.y - (from.y & 1)) / 2) - (to.x - (to.y - (to.y & 1)) / 2);
+        int dr = from.y - to.y;
+        return static_cast<float>((std::abs(dq) + std::abs(dr) + std::abs(dq + dr)) / 2);
+    }
+
+    template<typename IsOpen, typename Visit>
+    static void ForEachNeighbor(const Position& pos, const IsOpen& is_open, const Visit& visit) {
+        const int* offset_x = kOffsetX[pos.y & 1];
+        for (int direction = 0; direction < kNeighborCount; ++direction) {
+            Position neighbor(pos.x + offset_x[direction], pos.y + kOffsetY[direction]);
+            if (is_open(neighbor)) {
+                visit(neighbor, 1.0f);
+            }
+        }
+    }
+};
+
+#endif //RAYLIBSTARTER_MOVEMENTMODEL_H
@@ -0,0 +1,72 @@
+#include "NeighborMask.h"
+
+// ******************** STATIC MEMBER DEFINITIONS ********************
+
+constexpr bool NeighborMask::kUsesAvx2;
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// ******************** MASK SETUP ********************
+
+void NeighborMask::Resize(int width, int height) {
+    width_ = width;
+    height_ = height;
+    stride_ = width + 2;
+    cells_.assign(static_cast<std::size_t>(stride_) * (height + 2), 0);
+}
+
+// ******************** NEIGHBOUR COUNTS ********************
+
+void NeighborMask::CountNeighbors(int first_row, int end_row, uint8_t* counts) const {
+    for (int y = first_row; y < end_row; ++y) {
+        // Cell x of a row is at row[x + 1], so row[x] .. row[x + 2] cover its three columns
+        const uint8_t* above = cells_.data() + static_cast<std::size_t>(y) * stride_;
+        uint8_t* row_counts = counts + static_cast<std::size_t>(y - first_row) * width_;
+
+        int x = 0;
+#if defined(__AVX2__)
+        const uint8_t* middle = above + stride_;
+        const uint8_t* below = middle + stride_;
+        // 32 cells per step; the largest count is 8, so byte lanes cannot overflow
+        for (; x + 32 <= width_; x += 32) {
+            auto load = [x](const uint8_t* row, int offset) {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + x + offset));
+            };
+            __m256i sum = _mm256_add_epi8(_mm256_add_epi8(load(above, 0), load(above, 1)),
+                                          _mm256_add_epi8(load(above, 2), load(middle, 0)));
+            sum = _mm256_add_epi8(sum, _mm256_add_epi8(_mm256_add_epi8(load(middle, 2), load(below, 0)),
+                                                       _mm256_add_epi8(load(below, 1), load(below, 2))));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(row_counts + x), sum);
+        }
+#endif
+        // Scalar loop for the rest (the whole row without AVX2)
+        CountRowScalar(above, x, row_counts);
+    }
+}
+
+void NeighborMask::CountNeighborsScalar(int first_row, int end_row, uint8_t* counts) const {
+    for (int y = first_row; y < end_row; ++y) {
+        CountRowScalar(cells_.data() + static_cast<std::size_t>(y) * stride_, 0,
+                       counts + static_cast<std::size_t>(y - first_row) * width_);
+    }
+}
+
+void NeighborMask::CountRowScalar(const uint8_t* above, int first_x, uint8_t* row_counts) const {
+    const uint8_t* middle = above + stride_;
+    const uint8_t* below = middle + stride_;
+    // Compilers vectorise this with SSE2
+    for (int x = first_x; x < width_; ++x) {
+        row_counts[x] = static_cast<uint8_t>(above[x] + above[x + 1] + above[x + 2] +
+                                             middle[x] + middle[x + 2] +
+                                             below[x] + below[x + 1] + below[x + 2]);
+    }
+}
+
+int NeighborMask::CountNeighbors(int x, int y) const {
+    std::size_t center = GetIndex(x, y);
+    const uint8_t* above = cells_.data() + center - stride_;
+    const uint8_t* middle = cells_.data() + center;
+    const uint8_t* below = cells_.data() + center + stride_;
+    return above[-1] + above[0] + above[1] + middle[-1] + middle[1] + below[-1] + below[0] + below[1];
+}
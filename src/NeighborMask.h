@@ -0,0 +1,59 @@
+#ifndef RAYLIBSTARTER_NEIGHBORMASK_H
+#define RAYLIBSTARTER_NEIGHBORMASK_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// ******************** NEIGHBOR MASK ********************
+
+// One byte (0 or 1) per cell with a border of zero cells, so a 3x3 neighbourhood can be read
+// without bounds checks. CountNeighbors turns the mask into per-cell counts of set neighbours in
+// one sweep over whole rows; terrain classification and cellular-automata passes share it.
+// Cells in different rows never share a byte, so rows can be filled and counted in parallel.
+class NeighborMask {
+public:
+    NeighborMask() : width_(0), height_(0), stride_(2) {}
+
+    // Clears every cell
+    void Resize(int width, int height);
+
+    int GetWidth() const { return width_; }
+    int GetHeight() const { return height_; }
+
+    void Set(int x, int y, bool value) { cells_[GetIndex(x, y)] = value ? 1 : 0; }
+    bool Get(int x, int y) const { return cells_[GetIndex(x, y)] != 0; }
+
+    // Number of set cells among the 8 neighbours of every cell in rows [first_row, end_row),
+    // written row-major to counts (width per row, counts[0] is cell (0, first_row)). Uses AVX2
+    // when the build enables it (ENABLE_NATIVE_ARCH, -mavx2), a scalar loop otherwise.
+    void CountNeighbors(int first_row, int end_row, uint8_t* counts) const;
+
+    // The scalar loop on its own, to check the vector path against
+    void CountNeighborsScalar(int first_row, int end_row, uint8_t* counts) const;
+
+    static constexpr bool kUsesAvx2 =
+#if defined(__AVX2__)
+            true;
+#else
+            false;
+#endif
+
+    // Single cell
+    int CountNeighbors(int x, int y) const;
+
+private:
+    int width_;
+    int height_;
+    int stride_;                  // width + 2
+    std::vector<uint8_t> cells_;  // (width + 2) x (height + 2), cell (x, y) at (x + 1, y + 1)
+
+    // Cells [first_x, width) of one row
+    void CountRowScalar(const uint8_t* above, int first_x, uint8_t* row_counts) const;
+
+    std::size_t GetIndex(int x, int y) const {
+        return static_cast<std::size_t>(y + 1) * stride_ + (x + 1);
+    }
+};
+
+#endif //RAYLIBSTARTER_NEIGHBORMASK_H
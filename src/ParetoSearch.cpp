@@ -0,0 +1,381 @@
+#include "ParetoSearch.h"
+#include "Map.h"
+#include <algorithm>
+#include <queue>
+#include <tuple>
+
+namespace {
+    const int kDirectionX[4] = {0, 1, 0, -1};
+    const int kDirectionY[4] = {-1, 0, 1, 0};
+}
+
+// ******************** STATIC MEMBER DEFINITIONS ********************
+
+const int ParetoSearch::kStartNode;
+const int ParetoSearch::kGoalNode;
+
+// ******************** CONSTRUCTOR & DESTRUCTOR ********************
+
+ParetoSearch::ParetoSearch() : width_(0), height_(0) {
+}
+
+ParetoSearch::~ParetoSearch() {
+    // No dynamic cleanup needed
+}
+
+// ******************** SEARCH ********************
+
+template<typename TileContainer>
+ParetoResult ParetoSearch::FindFront(const Map<TileContainer>& game_map, const Position& start, const Position& goal,
+                                     int step_budget, int max_labels_per_tile) {
+    ParetoResult result;
+    SearchStats& stats = result.stats;
+
+    width_ = game_map.GetWidth();
+    height_ = game_map.GetHeight();
+    node_positions_.clear();
+    node_values_.clear();
+
+    // Distances and loot are gathered over the whole map, which a streamed world cannot hold
+    if (IsStreamedTileContainer<TileContainer>::value) {
+        return result;
+    }
+    if (!game_map.IsValidPosition(start) || !game_map.IsValidPosition(goal) ||
+        !game_map.GetTile(start).IsTraversable() || !game_map.GetTile(goal).IsTraversable()) {
+        return result;
+    }
+
+    size_t tile_count = static_cast<size_t>(width_) * height_;
+    int start_tile = start.y * width_ + start.x;
+    int goal_tile = goal.y * width_ + goal.x;
+    CollectTiles(game_map);
+
+    node_positions_.push_back(start);
+    node_positions_.push_back(goal);
+    node_values_.assign(2, 0);
+    parent_directions_.assign(2 * tile_count, 0);
+
+    RunBreadthFirstSearch(kStartNode);
+    std::vector<int> start_distances = distances_;
+    RunBreadthFirstSearch(kGoalNode);
+
+    int shortest = distances_[start_tile];
+    if (shortest < 0) {
+        return result;
+    }
+    result.step_budget = (step_budget <= 0) ? shortest * 2 : std::max(step_budget, shortest);
+    int budget = result.step_budget;
+    max_labels_per_tile = std::max(1, max_labels_per_tile);
+
+    // Only loot that some route within the budget can pass becomes a node
+    std::vector<int> loot_tiles;
+    for (int tile = 0; tile < static_cast<int>(tile_count); ++tile) {
+        if (tile_values_[tile] > 0 && tile != start_tile && tile != goal_tile && start_distances[tile] >= 0 &&
+            start_distances[tile] + distances_[tile] <= budget) {
+            loot_tiles.push_back(tile);
+        }
+    }
+    if (static_cast<int>(loot_tiles.size()) > kMaxLootTiles) {
+        std::stable_sort(loot_tiles.begin(), loot_tiles.end(), [&](int a, int b) {
+            return tile_values_[a] > tile_values_[b];
+        });
+        loot_tiles.resize(kMaxLootTiles);
+    }
+    for (int tile : loot_tiles) {
+        node_positions_.push_back(Position(tile % width_, tile / width_));
+        node_values_.push_back(tile_values_[tile]);
+    }
+
+    // Distance matrix rows; the goal search is still in the scratch array
+    int node_count = GetNodeCount();
+    node_distances_.assign(static_cast<size_t>(node_count) * node_count, 0);
+    auto fill_row = [&](int node, const std::vector<int>& distances) {
+        for (int other = 0; other < node_count; ++other) {
+            const Position& pos = node_positions_[other];
+            node_distances_[node * node_count + other] = distances[pos.y * width_ + pos.x];
+        }
+    };
+    fill_row(kStartNode, start_distances);
+    fill_row(kGoalNode, distances_);
+
+    parent_directions_.resize(static_cast<size_t>(node_count) * tile_count);
+    for (int node = 2; node < node_count; ++node) {
+        RunBreadthFirstSearch(node);
+        fill_row(node, distances_);
+    }
+
+    labels_.clear();
+    expanded_heads_.assign(node_count, -1);
+    expanded_counts_.assign(node_count, 0);
+
+    // steps + distance to the goal, negated value, label; ties go to the more valuable label
+    typedef std::tuple<int, int, int> QueueEntry;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> open_set;
+
+    Label start_label;
+    start_label.loot_mask = 0;
+    start_label.node = kStartNode;
+    start_label.steps = 0;
+    start_label.value = 0;
+    start_label.parent = -1;
+    start_label.next_expanded = -1;
+    labels_.push_back(start_label);
+    open_set.push(QueueEntry(shortest, 0, 0));
+    stats.pushes++;
+    stats.peak_open_size = 1;
+
+    int best_value = -1;
+    bool out_of_labels = false;
+
+    while (!open_set.empty() && !out_of_labels) {
+        int label_index = std::get<2>(open_set.top());
+        open_set.pop();
+        stats.pops++;
+
+        const Label label = labels_[label_index];
+
+        // Beaten by a route already found, or by an expanded label on this node
+        if (label.value + RemainingValueBound(label.node, label.steps, label.loot_mask, budget) <= best_value ||
+            IsDominatedAtNode(label.node, label.loot_mask)) {
+            stats.stale_pops++;
+            continue;
+        }
+        if (expanded_counts_[label.node] >= max_labels_per_tile) {
+            result.truncated = true;
+            continue;
+        }
+
+        labels_[label_index].next_expanded = expanded_heads_[label.node];
+        expanded_heads_[label.node] = label_index;
+        expanded_counts_[label.node]++;
+        result.nodes_explored++;
+        stats.peak_closed_size = result.nodes_explored;
+
+        // Routes reach the goal in order of steps, so only more value makes a new front entry.
+        // Leaving the goal again never helps: going straight to the next loot is no longer.
+        if (label.node == kGoalNode) {
+            if (label.value > best_value) {
+                best_value = label.value;
+                ParetoPath route = BuildRoute(label_index);
+                if (!result.front.empty() && result.front.back().steps == route.steps) {
+                    result.front.pop_back();
+                }
+                if (result.front.empty() || route.value > result.front.back().value) {
+                    result.front.push_back(route);
+                }
+            }
+            continue;
+        }
+
+        for (int node = 1; node < node_count; ++node) {
+            uint64_t loot_mask = label.loot_mask;
+            int value = label.value;
+            int steps = label.steps + GetNodeDistance(label.node, node);
+            if (node != kGoalNode) {
+                uint64_t loot_bit = uint64_t(1) << (node - 2);
+                if ((loot_mask & loot_bit) || steps + GetNodeDistance(node, kGoalNode) > budget) {
+                    continue;
+                }
+                loot_mask |= loot_bit;
+                value += node_values_[node];
+            }
+
+            if (value + RemainingValueBound(node, steps, loot_mask, budget) <= best_value ||
+                IsDominatedAtNode(node, loot_mask)) {
+                continue;
+            }
+
+            if (static_cast<int>(labels_.size()) >= kMaxLabels) {
+                result.truncated = true;
+                out_of_labels = true;
+                break;
+            }
+
+            Label next;
+            next.loot_mask = loot_mask;
+            next.node = node;
+            next.steps = steps;
+            next.value = value;
+            next.parent = label_index;
+            next.next_expanded = -1;
+            labels_.push_back(next);
+
+            open_set.push(QueueEntry(steps + GetNodeDistance(node, kGoalNode), -value,
+                                     static_cast<int>(labels_.size()) - 1));
+            stats.pushes++;
+            stats.peak_open_size = std::max(stats.peak_open_size, static_cast<int>(open_set.size()));
+        }
+    }
+
+    stats.bytes_allocated = labels_.capacity() * sizeof(Label) + parent_directions_.capacity() +
+                            traversable_.capacity() +
+                            (node_distances_.capacity() + tile_values_.capacity() + distances_.capacity() +
+                             queue_.capacity() + start_distances.capacity()) * sizeof(int) +
+                            stats.peak_open_size * sizeof(QueueEntry);
+    return result;
+}
+
+// ******************** SETUP ********************
+
+// Items are grouped per tile; emptied treasure chests no longer count
+template<typename TileContainer>
+void ParetoSearch::CollectTiles(const Map<TileContainer>& game_map) {
+    traversable_.assign(static_cast<size_t>(width_) * height_, 0);
+    for (int y = 0; y < height_; ++y) {
+        for (int x = 0; x < width_; ++x) {
+            traversable_[y * width_ + x] = game_map.GetTile(x, y).IsTraversable() ? 1 : 0;
+        }
+    }
+
+    tile_values_.assign(static_cast<size_t>(width_) * height_, 0);
+    for (const auto& item_with_pos : game_map.GetItemManager().GetAllItems()) {
+        const Position& pos = item_with_pos.position;
+        if (!game_map.IsValidPosition(pos) || item_with_pos.item->GetValue() <= 0) continue;
+
+        const Tile& tile = game_map.GetTile(pos);
+        if (!tile.IsTraversable()) continue;
+        if (item_with_pos.is_in_treasure_chest && !tile.IsClosedTreasureChest()) continue;
+
+        tile_values_[pos.y * width_ + pos.x] += item_with_pos.item->GetValue();
+    }
+}
+
+void ParetoSearch::RunBreadthFirstSearch(int source_node) {
+    size_t tile_count = static_cast<size_t>(width_) * height_;
+    distances_.assign(tile_count, -1);
+    queue_.clear();
+
+    uint8_t* directions = &parent_directions_[source_node * tile_count];
+    const Position& source = node_positions_[source_node];
+    distances_[source.y * width_ + source.x] = 0;
+    queue_.push_back(source.y * width_ + source.x);
+
+    // Directions index kDirectionX/Y; each visited tile stores the step back toward its parent
+    auto visit = [&](int neighbor, int distance, uint8_t back_direction) {
+        if (distances_[neighbor] < 0 && traversable_[neighbor]) {
+            distances_[neighbor] = distance;
+            directions[neighbor] = back_direction;
+            queue_.push_back(neighbor);
+        }
+    };
+
+    for (size_t head = 0; head < queue_.size(); ++head) {
+        int tile = queue_[head];
+        int x = tile % width_;
+        int distance = distances_[tile] + 1;
+        if (tile >= width_) visit(tile - width_, distance, 2);
+        if (x + 1 < width_) visit(tile + 1, distance, 3);
+        if (tile + width_ < static_cast<int>(tile_count)) visit(tile + width_, distance, 0);
+        if (x > 0) visit(tile - 1, distance, 1);
+    }
+}
+
+// ******************** PRUNING ********************
+
+// Value of all uncollected loot that a detour from the node could still pick up within the budget
+int ParetoSearch::RemainingValueBound(int node, int steps, uint64_t loot_mask, int step_budget) const {
+    int bound = 0;
+    for (int loot_node = 2; loot_node < GetNodeCount(); ++loot_node) {
+        if (loot_mask & (uint64_t(1) << (loot_node - 2))) continue;
+
+        if (steps + GetNodeDistance(node, loot_node) + GetNodeDistance(loot_node, kGoalNode) <= step_budget) {
+            bound += node_values_[loot_node];
+        }
+    }
+    return bound;
+}
+
+// Expanded labels on a node never have more steps than the labels still to come
+bool ParetoSearch::IsDominatedAtNode(int node, uint64_t loot_mask) const {
+    for (int index = expanded_heads_[node]; index != -1; index = labels_[index].next_expanded) {
+        if ((labels_[index].loot_mask & loot_mask) == loot_mask) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ******************** FRONT ENTRIES ********************
+
+ParetoPath ParetoSearch::BuildRoute(int label_index) const {
+    std::vector<int> nodes;
+    for (int index = label_index; index != -1; index = labels_[index].parent) {
+        nodes.push_back(labels_[index].node);
+    }
+    std::reverse(nodes.begin(), nodes.end());
+
+    ParetoPath route;
+    route.path.push_back(node_positions_[nodes.front()]);
+    for (size_t i = 1; i < nodes.size(); ++i) {
+        AppendLeg(route.path, nodes[i]);
+    }
+    route.steps = static_cast<int>(route.path.size()) - 1;
+
+    // Everything passed over counts, including the start, the goal and loot between the stops
+    std::vector<int> tiles;
+    for (const Position& pos : route.path) {
+        tiles.push_back(pos.y * width_ + pos.x);
+    }
+    std::sort(tiles.begin(), tiles.end());
+    tiles.erase(std::unique(tiles.begin(), tiles.end()), tiles.end());
+    for (int tile : tiles) {
+        route.value += tile_values_[tile];
+    }
+    return route;
+}
+
+// Follows the parent directions of the target's search from the end of the path to the target
+void ParetoSearch::AppendLeg(std::vector<Position>& path, int to_node) const {
+    size_t tile_count = static_cast<size_t>(width_) * height_;
+    const uint8_t* directions = &parent_directions_[to_node * tile_count];
+    const Position& target = node_positions_[to_node];
+
+    Position current = path.back();
+    while (!(current == target)) {
+        int direction = directions[current.y * width_ + current.x];
+        current = Position(current.x + kDirectionX[direction], current.y + kDirectionY[direction]);
+        path.push_back(current);
+    }
+}
+
+// ******************** EXPLICIT TEMPLATE INSTANTIATIONS ********************
+
+template ParetoResult ParetoSearch::FindFront<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map, const Position& start, const Position& goal,
+        int step_budget, int max_labels_per_tile);
+
+// Flat row-major grid (the default Map<> container)
+
+template ParetoResult ParetoSearch::FindFront<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map, const Position& start, const Position& goal,
+        int step_budget, int max_labels_per_tile);
+
+// Morton-ordered 8x8 blocks
+
+template ParetoResult ParetoSearch::FindFront<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map, const Position& start, const Position& goal,
+        int step_budget, int max_labels_per_tile);
+
+// Type byte plus bit planes
+
+template ParetoResult ParetoSearch::FindFront<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map, const Position& start, const Position& goal,
+        int step_budget, int max_labels_per_tile);
+
+// Build-time 64x64 grid
+
+template ParetoResult ParetoSearch::FindFront<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map, const Position& start, const Position& goal,
+        int step_budget, int max_labels_per_tile);
+
+// Streamed 64x64 chunks
+
+template ParetoResult ParetoSearch::FindFront<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map, const Position& start, const Position& goal,
+        int step_budget, int max_labels_per_tile);
+
+// Memory-mapped map file
+
+template ParetoResult ParetoSearch::FindFront<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map, const Position& start, const Position& goal,
+        int step_budget, int max_labels_per_tile);
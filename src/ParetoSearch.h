@@ -0,0 +1,93 @@
+#ifndef RAYLIBSTARTER_PARETOSEARCH_H
+#define RAYLIBSTARTER_PARETOSEARCH_H
+
+#include "Tile.h"
+#include "Pathfinding.h"
+#include <vector>
+#include <cstdint>
+
+// Forward declaration
+template<typename TileContainer> class Map;
+
+// ******************** PARETO SEARCH ********************
+
+// Bi-objective label-setting search: fewer steps versus more item value collected. Between two
+// pickups a route always follows a shortest path, so labels only live on the start, the goal and
+// the loot tiles; breadth-first searches from those tiles give exact distances and the parent
+// directions that turn a front entry back into single steps.
+//   - A label is a (loot tile, steps, collected loot) triple with the collected loot as a bit mask.
+//     Labels are expanded by steps + exact distance to the goal, so on one tile they come out with
+//     non-decreasing steps and a label is dominated once an expanded label there holds a superset.
+//   - A label is dropped once its value plus every uncollected loot it could still detour to within
+//     the step budget cannot beat the best route found so far.
+//   - Labels live in one flat pool; expanded labels are chained per tile.
+class ParetoSearch {
+public:
+    // Loot tiles beyond this count (the least valuable ones) are ignored
+    static const int kMaxLootTiles = 64;
+    // Upper limit on the label pool of a single search
+    static const int kMaxLabels = 1 << 20;
+
+    // Constructor
+    ParetoSearch();
+
+    // Destructor
+    ~ParetoSearch();
+
+    template<typename TileContainer>
+    ParetoResult FindFront(const Map<TileContainer>& game_map, const Position& start, const Position& goal,
+                           int step_budget, int max_labels_per_tile);
+
+    int GetLootTileCount() const { return static_cast<int>(node_positions_.size()) - 2; }
+
+private:
+    struct Label {
+        uint64_t loot_mask;     // Loot tiles collected so far
+        int node;
+        int steps;
+        int value;
+        int parent;             // Label index, -1 for the start
+        int next_expanded;      // Next expanded label on the same node, -1 at the end
+    };
+
+    // Graph nodes: 0 = start, 1 = goal, 2.. = loot tiles (loot bit = node - 2)
+    static const int kStartNode = 0;
+    static const int kGoalNode = 1;
+
+    int width_;
+    int height_;
+
+    std::vector<Position> node_positions_;
+    std::vector<int> node_values_;
+    std::vector<int> node_distances_;          // Row-major node x node, exact steps
+    std::vector<uint8_t> parent_directions_;   // Per source node and tile: direction of the step toward the source
+    std::vector<int> tile_values_;             // Item value per tile
+    std::vector<uint8_t> traversable_;
+
+    // Breadth-first search scratch
+    std::vector<int> distances_;
+    std::vector<int> queue_;
+
+    // Label pool and per-node chains of expanded labels
+    std::vector<Label> labels_;
+    std::vector<int> expanded_heads_;
+    std::vector<int> expanded_counts_;
+
+    // Setup
+    template<typename TileContainer>
+    void CollectTiles(const Map<TileContainer>& game_map);
+
+    void RunBreadthFirstSearch(int source_node);
+
+    // Pruning
+    int RemainingValueBound(int node, int steps, uint64_t loot_mask, int step_budget) const;
+    bool IsDominatedAtNode(int node, uint64_t loot_mask) const;
+
+    // Front entries
+    int GetNodeCount() const { return static_cast<int>(node_positions_.size()); }
+    int GetNodeDistance(int from_node, int to_node) const { return node_distances_[from_node * GetNodeCount() + to_node]; }
+    ParetoPath BuildRoute(int label_index) const;
+    void AppendLeg(std::vector<Position>& path, int to_node) const;
+};
+
+#endif //RAYLIBSTARTER_PARETOSEARCH_H
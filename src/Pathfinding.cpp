@@ -1,14 +1,33 @@
 #include "Pathfinding.h"
 #include "Map.h"
+#include "SubgoalGraph.h"
+#include "RectangleSymmetryReduction.h"
+#include "DeadEndAnalysis.h"
+#include "SearchWorkspace.h"
+#include "FixedSearchWorkspace.h"
+#include "ParetoSearch.h"
+#include "MemoryBoundedSearch.h"
+#include "TerrainCosts.h"
 #include <iostream>
 #include <cmath>
 #include <algorithm>
 #include <chrono>
 #include <iomanip>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+// ******************** STATIC MEMBER DEFINITIONS ********************
+
+const int Pathfinding::kMaxPlannedBombs;
+const int Pathfinding::kDefaultParetoLabelsPerTile;
+const int Pathfinding::kDefaultTranspositionEntries;
+const int Pathfinding::kDefaultSmaNodeBudget;
 
 // ******************** CONSTRUCTOR & DESTRUCTOR ********************
 
-Pathfinding::Pathfinding() {
+Pathfinding::Pathfinding()
+        : verbose_(true), dead_end_pruning_(true), terrain_costs_(std::make_unique<TerrainCosts>()) {
     std::cout << "Pathfinding system initialized." << std::endl;
 }
 
@@ -16,83 +35,189 @@ Pathfinding::~Pathfinding() {
     // No dynamic cleanup needed
 }
 
+// ******************** MEMORY ESTIMATION HELPERS ********************
+
+// Approximate footprint of a node-based hash container: entry + next pointer + cached hash, plus buckets
+template<typename HashContainer>
+static std::size_t EstimateHashContainerBytes(const HashContainer& container) {
+    using Entry = typename HashContainer::value_type;
+    return container.size() * (sizeof(Entry) + 2 * sizeof(void*)) +
+           container.bucket_count() * sizeof(void*);
+}
+
+// ******************** TERRAIN COST HELPERS ********************
+
+// Streamed maps are never read whole: they skip the packed per-tile cost grid and price each
+// entered tile through its type instead
+template<typename TileContainer>
+static void SynchronizeTerrainCosts(TerrainCosts& terrain, const Map<TileContainer>& game_map) {
+    if (!IsStreamedTileContainer<TileContainer>::value) {
+        terrain.Synchronize(game_map);
+    }
+}
+
+template<typename TileContainer>
+static float GetEntryCost(const TerrainCosts& terrain, const Map<TileContainer>& game_map, const Position& pos) {
+    if (IsStreamedTileContainer<TileContainer>::value) {
+        return terrain.GetCost(game_map.GetTile(pos).GetType());
+    }
+    return terrain.GetTileCost(pos.y * game_map.GetWidth() + pos.x);
+}
+
 // ******************** A* ALGORITHM IMPLEMENTATION ********************
 
 template<typename TileContainer>
-PathResult Pathfinding::FindPathAStar(const Position& start, const Position& goal, const Map<TileContainer>& game_map) {
-    auto start_time = std::chrono::high_resolution_clock::now();
+PathResult Pathfinding::FindPathAStar(const Position& start, const Position& goal, const Map<TileContainer>& game_map,
+                                      const SearchLimits& limits) {
+    return FindPathAStarWithMovement<FourWayMovement>(start, goal, game_map, limits);
+}
+
+template<typename Movement, typename TileContainer>
+PathResult Pathfinding::FindPathAStarWithMovement(const Position& start, const Position& goal,
+                                                  const Map<TileContainer>& game_map, const SearchLimits& limits) {
+    if constexpr (std::is_same<Movement, FourWayMovement>::value &&
+                  TileContainerExtent<TileContainer>::kWidth > 0) {
+        constexpr int kWidth = TileContainerExtent<TileContainer>::kWidth;
+        constexpr int kHeight = TileContainerExtent<TileContainer>::kHeight;
+        // A byte cap below the fixed footprint is left to the node-based search, which grows
+        using Workspace = FixedSearchWorkspace<kWidth, kHeight>;
+        if constexpr (Workspace::kFitsOnStack) {
+            if (limits.max_bytes == 0 || limits.max_bytes > Workspace::GetBytesAllocated()) {
+                return FindPathAStarFixed(start, goal, game_map, limits);
+            }
+        }
+    }
+
+    SynchronizeTerrainCosts(*terrain_costs_, game_map);
+    const TerrainCosts& terrain = *terrain_costs_;
+    float heuristic_scale = terrain.GetMinimumCost();
+
+    // Dead ends are only known for 4-way movement, and swamps assume every step costs the same;
+    // the analysis covers the whole map, so streamed maps go without it
+    bool prune_dead_ends = dead_end_pruning_ && terrain.IsUniform() &&
+                           std::is_same<Movement, FourWayMovement>::value &&
+                           !IsStreamedTileContainer<TileContainer>::value;
+
+    // Bring the pruning analysis up to date first; that work is per map, not per query
+    if (prune_dead_ends) {
+        if (!dead_end_analysis_) {
+            dead_end_analysis_ = std::make_unique<DeadEndAnalysis>();
+        }
+        dead_end_analysis_->Synchronize(game_map);
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
 
     PathResult result;
     result.nodes_explored = 0;
 
     // Validate start and goal positions
     if (!game_map.IsValidPosition(start) || !game_map.IsValidPosition(goal)) {
-        std::cout << "Invalid start or goal position!" << std::endl;
+        if (verbose_) std::cout << "Invalid start or goal position!" << std::endl;
+        FinishSearch(result, "A*", start, goal, game_map, start_time);
         return result;
     }
 
     if (!game_map.GetTile(start).IsTraversable() || !game_map.GetTile(goal).IsTraversable()) {
-        std::cout << "Start or goal position is not traversable!" << std::endl;
+        if (verbose_) std::cout << "Start or goal position is not traversable!" << std::endl;
+        FinishSearch(result, "A*", start, goal, game_map, start_time);
         return result;
     }
 
+    SearchStats& stats = result.stats;
+
     // Priority queue for open set (nodes to explore)
-    std::priority_queue<PathNode*, std::vector<PathNode*>, PathNodeComparator> open_set;
+    std::priority_queue<OpenListEntry, std::vector<OpenListEntry>, OpenListEntryComparator> open_set;
 
     // Hash maps for tracking visited nodes and costs
     std::unordered_map<Position, PathNode*, PositionHash, PositionEqual> all_nodes;
     std::unordered_map<Position, float, PositionHash, PositionEqual> g_costs;
+    int closed_count = 0;
 
     // Create and add start node
-    PathNode* start_node = new PathNode(start, 0, CalculateHeuristic(start, goal));
-    open_set.push(start_node);
+    PathNode* start_node = new PathNode(start, 0, heuristic_scale * Movement::Heuristic(start, goal));
+    open_set.push(OpenListEntry(start_node, start_node->f_cost, 0));
+    stats.pushes++;
+    stats.peak_open_size = 1;
     all_nodes[start] = start_node;
     g_costs[start] = 0;
 
-    std::cout << "\n=== A* PATHFINDING ===" << std::endl;
-    std::cout << "Start: (" << start.x << ", " << start.y << ")" << std::endl;
-    std::cout << "Goal: (" << goal.x << ", " << goal.y << ")" << std::endl;
-    std::cout << "Searching..." << std::endl;
+    DeadEndQuery pruning_query;
+    if (prune_dead_ends) {
+        pruning_query = dead_end_analysis_->MakeQuery(start, goal);
+    }
+    int pruned_tiles = 0;
+
+    if (verbose_) {
+        std::cout << "\n=== A* PATHFINDING ===" << std::endl;
+        std::cout << "Start: (" << start.x << ", " << start.y << ")" << std::endl;
+        std::cout << "Goal: (" << goal.x << ", " << goal.y << ")" << std::endl;
+        std::cout << "Searching..." << std::endl;
+    }
+
+    PathNode* goal_node = nullptr;
+
+    // Fallback target when a limit stops the search; only a strictly closer tile replaces the start
+    PathNode* closest_node = start_node;
+    bool limit_reached = false;
+
+    auto estimate_bytes = [&]() {
+        return all_nodes.size() * sizeof(PathNode) +
+               EstimateHashContainerBytes(all_nodes) +
+               EstimateHashContainerBytes(g_costs) +
+               stats.peak_open_size * sizeof(OpenListEntry);
+    };
 
     while (!open_set.empty()) {
+        if ((limits.max_expansions > 0 && result.nodes_explored >= limits.max_expansions) ||
+            (limits.max_bytes > 0 && estimate_bytes() >= limits.max_bytes)) {
+            limit_reached = true;
+            break;
+        }
+
         // Get node with lowest f_cost
-        PathNode* current = open_set.top();
+        OpenListEntry entry = open_set.top();
         open_set.pop();
+        stats.pops++;
+
+        PathNode* current = entry.node;
+        if (entry.g_cost > current->g_cost || current->closed) {
+            stats.stale_pops++;
+            continue; // A cheaper entry for this node was pushed later
+        }
+
+        current->closed = true;
+        closed_count++;
+        stats.peak_closed_size = std::max(stats.peak_closed_size, closed_count);
         result.nodes_explored++;
 
         // Check if we reached the goal
         if (PositionsEqual(current->position, goal)) {
-            std::cout << "Path found!" << std::endl;
-            result.path = ReconstructPath(current);
-            result.total_cost = current->g_cost;
-            result.path_found = true;
-
-            // Cleanup memory
-            for (auto& pair : all_nodes) {
-                delete pair.second;
-            }
-
-            auto end_time = std::chrono::high_resolution_clock::now();
-            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
-            std::cout << "A* completed in " << duration.count() << " microseconds" << std::endl;
+            goal_node = current;
+            break;
+        }
 
-            return result;
+        if (current->h_cost < closest_node->h_cost ||
+            (current->h_cost == closest_node->h_cost && closest_node != start_node &&
+             current->g_cost < closest_node->g_cost)) {
+            closest_node = current;
         }
 
         // Explore neighbors
-        std::vector<Position> neighbors = GetNeighbors(current->position, game_map);
-
-        for (const Position& neighbor_pos : neighbors) {
-            if (!IsValidMove(neighbor_pos, game_map)) {
-                continue;
+        auto is_open = [&](const Position& pos) { return IsValidMove(pos, game_map); };
+        Movement::ForEachNeighbor(current->position, is_open, [&](const Position& neighbor_pos, float step_cost) {
+            // No shortest path runs through this tile
+            if (prune_dead_ends && dead_end_analysis_->IsPruned(neighbor_pos, pruning_query)) {
+                pruned_tiles++;
+                return;
             }
 
-            float tentative_g_cost = current->g_cost + CalculateDistance(current->position, neighbor_pos);
+            float tentative_g_cost = current->g_cost + step_cost * GetEntryCost(terrain, game_map, neighbor_pos);
 
             // Check if we found a better path to this neighbor
             auto g_cost_it = g_costs.find(neighbor_pos);
             if (g_cost_it != g_costs.end() && tentative_g_cost >= g_cost_it->second) {
-                continue; // Not a better path
+                return; // Not a better path
             }
 
             // Create the updated neighbor node
@@ -105,29 +230,213 @@ PathResult Pathfinding::FindPathAStar(const Position& start, const Position& goa
                 neighbor_node = node_it->second;
             }
 
+            // A cheaper path into an already expanded node reopens it
+            if (neighbor_node->closed) {
+                neighbor_node->closed = false;
+                closed_count--;
+                stats.reopens++;
+            }
+
             // Update neighbor with better path
             neighbor_node->g_cost = tentative_g_cost;
-            neighbor_node->h_cost = CalculateHeuristic(neighbor_pos, goal);
+            neighbor_node->h_cost = heuristic_scale * Movement::Heuristic(neighbor_pos, goal);
             neighbor_node->f_cost = neighbor_node->g_cost + neighbor_node->h_cost;
             neighbor_node->parent = current;
 
             g_costs[neighbor_pos] = tentative_g_cost;
-            open_set.push(neighbor_node);
+            open_set.push(OpenListEntry(neighbor_node, neighbor_node->f_cost, tentative_g_cost));
+            stats.pushes++;
+            stats.peak_open_size = std::max(stats.peak_open_size, static_cast<int>(open_set.size()));
+        });
+    }
+
+    if (goal_node) {
+        if (verbose_) std::cout << "Path found!" << std::endl;
+        result.path = ReconstructPath(goal_node);
+        result.total_cost = goal_node->g_cost;
+        result.path_found = true;
+    } else if (limit_reached) {
+        result.path = ReconstructPath(closest_node);
+        result.total_cost = closest_node->g_cost;
+        result.is_partial = true;
+        if (verbose_) {
+            std::cout << "Search limit reached after " << result.nodes_explored << " expansions; partial path to ("
+                      << closest_node->position.x << ", " << closest_node->position.y << ")" << std::endl;
         }
+    } else {
+        // No path found
+        if (verbose_) std::cout << "No path found to goal!" << std::endl;
     }
 
-    // No path found
-    std::cout << "No path found to goal!" << std::endl;
+    if (verbose_ && prune_dead_ends) {
+        std::cout << "Dead-end pruning skipped " << pruned_tiles << " neighbor checks" << std::endl;
+    }
+
+    stats.bytes_allocated = estimate_bytes();
 
     // Cleanup memory
     for (auto& pair : all_nodes) {
         delete pair.second;
     }
 
-    auto end_time = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
-    std::cout << "A* completed in " << duration.count() << " microseconds (no path)" << std::endl;
+    FinishSearch(result, "A*", start, goal, game_map, start_time);
+    return result;
+}
+
+template<int Width, int Height>
+PathResult Pathfinding::FindPathAStarFixed(const Position& start, const Position& goal,
+                                           const Map<FixedGrid<Width, Height>>& game_map, const SearchLimits& limits) {
+    using Grid = FixedGrid<Width, Height>;
+    using Workspace = FixedSearchWorkspace<Width, Height>;
+
+    SynchronizeTerrainCosts(*terrain_costs_, game_map);
+    const TerrainCosts& terrain = *terrain_costs_;
+    float heuristic_scale = terrain.GetMinimumCost();
+
+    bool prune_dead_ends = dead_end_pruning_ && terrain.IsUniform();
+    if (prune_dead_ends) {
+        if (!dead_end_analysis_) {
+            dead_end_analysis_ = std::make_unique<DeadEndAnalysis>();
+        }
+        dead_end_analysis_->Synchronize(game_map);
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    PathResult result;
+    result.nodes_explored = 0;
+
+    if (!game_map.IsValidPosition(start) || !game_map.IsValidPosition(goal)) {
+        if (verbose_) std::cout << "Invalid start or goal position!" << std::endl;
+        FinishSearch(result, "A*", start, goal, game_map, start_time);
+        return result;
+    }
+
+    if (!game_map.GetTile(start).IsTraversable() || !game_map.GetTile(goal).IsTraversable()) {
+        if (verbose_) std::cout << "Start or goal position is not traversable!" << std::endl;
+        FinishSearch(result, "A*", start, goal, game_map, start_time);
+        return result;
+    }
+
+    SearchStats& stats = result.stats;
+    const Tile* tiles = game_map.GetTileContainer().Data();
+    auto position_of = [](int tile) { return Position(tile % Grid::kStride, tile / Grid::kStride); };
+    auto heuristic = [&](int tile) { return heuristic_scale * FourWayMovement::Heuristic(position_of(tile), goal); };
+
+    Workspace workspace;
+    workspace.BeginSearch();
+
+    int start_tile = static_cast<int>(Grid::GetIndex(start.x, start.y));
+    int goal_tile = static_cast<int>(Grid::GetIndex(goal.x, goal.y));
+    workspace.Relax(start_tile, 0.0f, heuristic(start_tile), Workspace::kNoTile);
+    stats.pushes++;
+    stats.peak_open_size = 1;
+
+    DeadEndQuery pruning_query;
+    if (prune_dead_ends) {
+        pruning_query = dead_end_analysis_->MakeQuery(start, goal);
+    }
+    int pruned_tiles = 0;
+
+    if (verbose_) {
+        std::cout << "\n=== A* PATHFINDING ===" << std::endl;
+        std::cout << "Start: (" << start.x << ", " << start.y << ")" << std::endl;
+        std::cout << "Goal: (" << goal.x << ", " << goal.y << ")" << std::endl;
+        std::cout << "Searching..." << std::endl;
+    }
+
+    bool goal_reached = false;
+    int closest_tile = start_tile;
+    float closest_h = heuristic(start_tile);
+    bool limit_reached = false;
+    int closed_count = 0;
+
+    // The workspace is the whole footprint and fits any byte cap (see FindPathAStarWithMovement)
+    while (workspace.HasOpen()) {
+        if (limits.max_expansions > 0 && result.nodes_explored >= limits.max_expansions) {
+            limit_reached = true;
+            break;
+        }
+
+        int current = workspace.PopOpen();
+        stats.pops++;
+        closed_count++;
+        stats.peak_closed_size = std::max(stats.peak_closed_size, closed_count);
+        result.nodes_explored++;
+
+        if (current == goal_tile) {
+            goal_reached = true;
+            break;
+        }
+
+        float current_h = heuristic(current);
+        if (current_h < closest_h ||
+            (current_h == closest_h && closest_tile != start_tile &&
+             workspace.GetCost(current) < workspace.GetCost(closest_tile))) {
+            closest_tile = current;
+            closest_h = current_h;
+        }
+
+        for (int direction = 0; direction < FourWayMovement::kNeighborCount; ++direction) {
+            int neighbor = Workspace::GetNeighbor(current, direction);
+            if (neighbor == Workspace::kNoTile || !tiles[neighbor].IsTraversable()) {
+                continue;
+            }
+
+            // No shortest path runs through this tile
+            if (prune_dead_ends && dead_end_analysis_->IsPruned(position_of(neighbor), pruning_query)) {
+                pruned_tiles++;
+                continue;
+            }
+
+            float tentative_g_cost = workspace.GetCost(current) + terrain.GetTileCost(neighbor);
+            if (workspace.IsSeen(neighbor) && tentative_g_cost >= workspace.GetCost(neighbor)) {
+                continue; // Not a better path
+            }
+
+            // A cheaper path into an already expanded tile reopens it
+            if (workspace.Relax(neighbor, tentative_g_cost, tentative_g_cost + heuristic(neighbor), current)) {
+                closed_count--;
+                stats.reopens++;
+            }
+            stats.pushes++;
+            stats.peak_open_size = std::max(stats.peak_open_size, workspace.GetOpenCount());
+        }
+    }
+
+    auto reconstruct = [&](int tile) {
+        std::vector<Position> path;
+        for (; tile != Workspace::kNoTile; tile = workspace.GetParent(tile)) {
+            path.push_back(position_of(tile));
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    };
+
+    if (goal_reached) {
+        if (verbose_) std::cout << "Path found!" << std::endl;
+        result.path = reconstruct(goal_tile);
+        result.total_cost = workspace.GetCost(goal_tile);
+        result.path_found = true;
+    } else if (limit_reached) {
+        result.path = reconstruct(closest_tile);
+        result.total_cost = workspace.GetCost(closest_tile);
+        result.is_partial = true;
+        if (verbose_) {
+            Position closest = position_of(closest_tile);
+            std::cout << "Search limit reached after " << result.nodes_explored << " expansions; partial path to ("
+                      << closest.x << ", " << closest.y << ")" << std::endl;
+        }
+    } else {
+        if (verbose_) std::cout << "No path found to goal!" << std::endl;
+    }
+
+    if (verbose_ && prune_dead_ends) {
+        std::cout << "Dead-end pruning skipped " << pruned_tiles << " neighbor checks" << std::endl;
+    }
 
+    stats.bytes_allocated = Workspace::GetBytesAllocated();
+    FinishSearch(result, "A*", start, goal, game_map, start_time);
     return result;
 }
 
@@ -135,72 +444,79 @@ PathResult Pathfinding::FindPathAStar(const Position& start, const Position& goa
 
 template<typename TileContainer>
 PathResult Pathfinding::FindPathDijkstra(const Position& start, const Position& goal, const Map<TileContainer>& game_map) {
-    auto start_time = std::chrono::high_resolution_clock::now();
+    auto start_time = std::chrono::steady_clock::now();
 
     PathResult result;
     result.nodes_explored = 0;
 
     // Validate positions
     if (!game_map.IsValidPosition(start) || !game_map.IsValidPosition(goal)) {
+        FinishSearch(result, "Dijkstra", start, goal, game_map, start_time);
         return result;
     }
 
     if (!game_map.GetTile(start).IsTraversable() || !game_map.GetTile(goal).IsTraversable()) {
+        FinishSearch(result, "Dijkstra", start, goal, game_map, start_time);
         return result;
     }
 
+    SearchStats& stats = result.stats;
+
+    SynchronizeTerrainCosts(*terrain_costs_, game_map);
+    const TerrainCosts& terrain = *terrain_costs_;
+
     // Priority queue for Dijkstra (only uses g_cost, no heuristic)
-    std::priority_queue<PathNode*, std::vector<PathNode*>, PathNodeComparator> open_set;
+    std::priority_queue<OpenListEntry, std::vector<OpenListEntry>, OpenListEntryComparator> open_set;
     std::unordered_map<Position, PathNode*, PositionHash, PositionEqual> all_nodes;
     std::unordered_map<Position, float, PositionHash, PositionEqual> distances;
+    int closed_count = 0;
 
     // Initialize start node
     PathNode* start_node = new PathNode(start, 0, 0); // No heuristic for Dijkstra
     start_node->f_cost = 0; // f_cost = g_cost for Dijkstra
-    open_set.push(start_node);
+    open_set.push(OpenListEntry(start_node, 0, 0));
+    stats.pushes++;
+    stats.peak_open_size = 1;
     all_nodes[start] = start_node;
     distances[start] = 0;
 
-    std::cout << "\n=== DIJKSTRA PATHFINDING ===" << std::endl;
-    std::cout << "Start: (" << start.x << ", " << start.y << ")" << std::endl;
-    std::cout << "Goal: (" << goal.x << ", " << goal.y << ")" << std::endl;
-    std::cout << "Searching..." << std::endl;
+    if (verbose_) {
+        std::cout << "\n=== DIJKSTRA PATHFINDING ===" << std::endl;
+        std::cout << "Start: (" << start.x << ", " << start.y << ")" << std::endl;
+        std::cout << "Goal: (" << goal.x << ", " << goal.y << ")" << std::endl;
+        std::cout << "Searching..." << std::endl;
+    }
+
+    PathNode* goal_node = nullptr;
 
     while (!open_set.empty()) {
-        PathNode* current = open_set.top();
+        OpenListEntry entry = open_set.top();
         open_set.pop();
-        result.nodes_explored++;
-
-        if (PositionsEqual(current->position, goal)) {
-            std::cout << "Path found with Dijkstra!" << std::endl;
-            result.path = ReconstructPath(current);
-            result.total_cost = current->g_cost;
-            result.path_found = true;
-
-            // Cleanup
-            for (auto& pair : all_nodes) {
-                delete pair.second;
-            }
+        stats.pops++;
 
-            auto end_time = std::chrono::high_resolution_clock::now();
-            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
-            std::cout << "Dijkstra completed in " << duration.count() << " microseconds" << std::endl;
-
-            return result;
+        PathNode* current = entry.node;
+        if (entry.g_cost > current->g_cost || current->closed) {
+            stats.stale_pops++;
+            continue;
         }
 
-        std::vector<Position> neighbors = GetNeighbors(current->position, game_map);
+        current->closed = true;
+        closed_count++;
+        stats.peak_closed_size = std::max(stats.peak_closed_size, closed_count);
+        result.nodes_explored++;
 
-        for (const Position& neighbor_pos : neighbors) {
-            if (!IsValidMove(neighbor_pos, game_map)) {
-                continue;
-            }
+        if (PositionsEqual(current->position, goal)) {
+            goal_node = current;
+            break;
+        }
 
-            float new_distance = current->g_cost + CalculateDistance(current->position, neighbor_pos);
+        auto is_open = [&](const Position& pos) { return IsValidMove(pos, game_map); };
+        FourWayMovement::ForEachNeighbor(current->position, is_open, [&](const Position& neighbor_pos, float step_cost) {
+            float new_distance = current->g_cost + step_cost * GetEntryCost(terrain, game_map, neighbor_pos);
 
             auto dist_it = distances.find(neighbor_pos);
             if (dist_it != distances.end() && new_distance >= dist_it->second) {
-                continue;
+                return;
             }
 
             PathNode* neighbor_node;
@@ -212,163 +528,930 @@ PathResult Pathfinding::FindPathDijkstra(const Position& start, const Position&
                 neighbor_node = node_it->second;
             }
 
+            if (neighbor_node->closed) {
+                neighbor_node->closed = false;
+                closed_count--;
+                stats.reopens++;
+            }
+
             neighbor_node->g_cost = new_distance;
             neighbor_node->h_cost = 0; // Dijkstra doesn't use heuristic
             neighbor_node->f_cost = new_distance; // f_cost = g_cost for priority queue
             neighbor_node->parent = current;
 
             distances[neighbor_pos] = new_distance;
-            open_set.push(neighbor_node);
-        }
+            open_set.push(OpenListEntry(neighbor_node, new_distance, new_distance));
+            stats.pushes++;
+            stats.peak_open_size = std::max(stats.peak_open_size, static_cast<int>(open_set.size()));
+        });
+    }
+
+    if (goal_node) {
+        if (verbose_) std::cout << "Path found with Dijkstra!" << std::endl;
+        result.path = ReconstructPath(goal_node);
+        result.total_cost = goal_node->g_cost;
+        result.path_found = true;
+    } else {
+        if (verbose_) std::cout << "No path found with Dijkstra!" << std::endl;
     }
 
-    std::cout << "No path found with Dijkstra!" << std::endl;
+    stats.bytes_allocated = all_nodes.size() * sizeof(PathNode) +
+                            EstimateHashContainerBytes(all_nodes) +
+                            EstimateHashContainerBytes(distances) +
+                            stats.peak_open_size * sizeof(OpenListEntry);
 
     // Cleanup
     for (auto& pair : all_nodes) {
         delete pair.second;
     }
 
-    auto end_time = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
-    std::cout << "Dijkstra completed in " << duration.count() << " microseconds (no path)" << std::endl;
-
+    FinishSearch(result, "Dijkstra", start, goal, game_map, start_time);
     return result;
 }
 
-// ******************** UTILITY METHODS ********************
+// ******************** BOMB-AWARE SEARCH ********************
 
-void Pathfinding::PrintPath(const PathResult& result) const {
-    if (!result.path_found) {
-        std::cout << "No path to print!" << std::endl;
-        return;
+template<typename TileContainer>
+BombPathResult Pathfinding::FindPathWithBombs(const Position& start, const Position& goal,
+                                              const Map<TileContainer>& game_map, int bombs_available,
+                                              float blast_cost) {
+    auto start_time = std::chrono::steady_clock::now();
+
+    BombPathResult bomb_result;
+    PathResult& result = bomb_result.path_result;
+    SearchStats& stats = result.stats;
+
+    if (!game_map.IsValidPosition(start) || !game_map.IsValidPosition(goal) ||
+        !game_map.GetTile(start).IsTraversable() || !game_map.GetTile(goal).IsTraversable()) {
+        if (verbose_) std::cout << "Invalid start or goal position for bomb search!" << std::endl;
+        FinishSearch(result, "A* (bombs)", start, goal, game_map, start_time);
+        return bomb_result;
     }
 
-    std::cout << "\n=== PATH FOUND ===" << std::endl;
-    std::cout << "Path length: " << result.path.size() << " steps" << std::endl;
-    std::cout << "Total cost: " << result.total_cost << std::endl;
-    std::cout << "Nodes explored: " << result.nodes_explored << std::endl;
-
-    std::cout << "Path: ";
-    for (size_t i = 0; i < result.path.size(); ++i) {
-        std::cout << "(" << result.path[i].x << "," << result.path[i].y << ")";
-        if (i < result.path.size() - 1) {
-            std::cout << " -> ";
+    // Steps are priced like A*'s: the entry cost of the tile, a blasted tile counting as the dirt
+    // it becomes, so the heuristic is scaled by the cheapest entry cost
+    SynchronizeTerrainCosts(*terrain_costs_, game_map);
+    const TerrainCosts& terrain = *terrain_costs_;
+    float heuristic_scale = terrain.GetMinimumCost();
+    float blasted_entry_cost = terrain.GetCost(TileType::TRAVERSABLE_DIRT);
+
+    // A state is a tile plus the bombs left; labels are kept only for the tiles the search
+    // reaches, so the cost follows the route, not the map size (streamed maps included)
+    int bombs = std::max(0, std::min(bombs_available, kMaxPlannedBombs));
+    uint64_t layers = static_cast<uint64_t>(bombs) + 1;
+    uint64_t width = static_cast<uint64_t>(game_map.GetWidth());
+
+    struct TileLabels {
+        float g_costs[kMaxPlannedBombs + 1];
+        uint64_t parent_states[kMaxPlannedBombs + 1];
+        int most_bombs_closed;
+    };
+    std::unordered_map<uint64_t, TileLabels> labels;
+    auto labels_of = [&](uint64_t tile) -> TileLabels& {
+        auto inserted = labels.emplace(tile, TileLabels());
+        TileLabels& tile_labels = inserted.first->second;
+        if (inserted.second) {
+            std::fill(tile_labels.g_costs, tile_labels.g_costs + layers, std::numeric_limits<float>::infinity());
+            tile_labels.most_bombs_closed = -1;
         }
+        return tile_labels;
+    };
+
+    // f_cost, h_cost, state; ties on f go to the state closer to the goal
+    typedef std::tuple<float, float, uint64_t> QueueEntry;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> open_set;
+
+    auto tile_of = [&](const Position& pos) {
+        return static_cast<uint64_t>(pos.y) * width + static_cast<uint64_t>(pos.x);
+    };
+    const uint64_t kNoState = std::numeric_limits<uint64_t>::max();
+
+    uint64_t start_state = tile_of(start) * layers + bombs;
+    labels_of(tile_of(start)).g_costs[bombs] = 0;
+    float start_h = heuristic_scale * CalculateHeuristic(start, goal);
+    open_set.push(QueueEntry(start_h, start_h, start_state));
+    stats.pushes++;
+    stats.peak_open_size = 1;
+
+    if (verbose_) {
+        std::cout << "\n=== A* WITH BOMBS ===" << std::endl;
+        std::cout << "Start: " << PositionToString(start) << ", Goal: " << PositionToString(goal)
+                  << ", Bombs: " << bombs << std::endl;
     }
-    std::cout << std::endl;
-    std::cout << "==================" << std::endl;
-}
 
-void Pathfinding::PrintPathDetails(const PathResult& result) const {
-    PrintPath(result);
+    uint64_t goal_state = kNoState;
+    int closed_count = 0;
 
-    if (result.path_found && result.path.size() > 1) {
-        std::cout << "\n=== DETAILED PATH ANALYSIS ===" << std::endl;
-        for (size_t i = 0; i < result.path.size(); ++i) {
-            std::cout << "Step " << i << ": (" << result.path[i].x << ", " << result.path[i].y << ")";
-            if (i == 0) {
-                std::cout << " [START]";
-            } else if (i == result.path.size() - 1) {
-                std::cout << " [GOAL]";
+    while (!open_set.empty()) {
+        QueueEntry entry = open_set.top();
+        open_set.pop();
+        stats.pops++;
+
+        uint64_t state = std::get<2>(entry);
+        uint64_t tile = state / layers;
+        int bombs_left = static_cast<int>(state % layers);
+        TileLabels& current_labels = labels_of(tile);
+
+        // Stale, or an expanded label on this tile had at least as many bombs at no higher cost
+        if (std::get<0>(entry) > current_labels.g_costs[bombs_left] + std::get<1>(entry) ||
+            bombs_left <= current_labels.most_bombs_closed) {
+            stats.stale_pops++;
+            continue;
+        }
+
+        current_labels.most_bombs_closed = bombs_left;
+        closed_count++;
+        stats.peak_closed_size = closed_count;
+        result.nodes_explored++;
+
+        Position current(static_cast<int>(tile % width), static_cast<int>(tile / width));
+        if (PositionsEqual(current, goal)) {
+            goal_state = state;
+            break;
+        }
+
+        float current_g_cost = current_labels.g_costs[bombs_left];
+
+        // Blocked tiles are candidates too: a bomb may clear them
+        auto is_on_map = [&](const Position& pos) { return game_map.IsValidPosition(pos); };
+        FourWayMovement::ForEachNeighbor(current, is_on_map, [&](const Position& neighbor_pos, float step_cost) {
+            const auto& neighbor_tile = game_map.GetTile(neighbor_pos);
+
+            int next_bombs = bombs_left;
+            if (!neighbor_tile.IsTraversable()) {
+                if (!Tile::IsBlastableType(neighbor_tile.GetType()) || bombs_left == 0) {
+                    return;
+                }
+                step_cost = step_cost * blasted_entry_cost + blast_cost;
+                next_bombs--;
+            } else {
+                step_cost *= GetEntryCost(terrain, game_map, neighbor_pos);
             }
-            std::cout << std::endl;
+
+            float tentative_g_cost = current_g_cost + step_cost;
+
+            // Dominance: a label on this tile with at least as many bombs is already as cheap
+            uint64_t neighbor_tile_id = tile_of(neighbor_pos);
+            TileLabels& neighbor_labels = labels_of(neighbor_tile_id);
+            bool dominated = next_bombs <= neighbor_labels.most_bombs_closed;
+            for (int other_bombs = next_bombs; other_bombs <= bombs && !dominated; ++other_bombs) {
+                dominated = neighbor_labels.g_costs[other_bombs] <= tentative_g_cost;
+            }
+            if (dominated) {
+                return;
+            }
+
+            neighbor_labels.g_costs[next_bombs] = tentative_g_cost;
+            neighbor_labels.parent_states[next_bombs] = state;
+
+            float h_cost = heuristic_scale * CalculateHeuristic(neighbor_pos, goal);
+            open_set.push(QueueEntry(tentative_g_cost + h_cost, h_cost, neighbor_tile_id * layers + next_bombs));
+            stats.pushes++;
+            stats.peak_open_size = std::max(stats.peak_open_size, static_cast<int>(open_set.size()));
+        });
+    }
+
+    if (goal_state != kNoState) {
+        std::vector<uint64_t> states;
+        for (uint64_t state = goal_state; state != start_state;
+             state = labels.at(state / layers).parent_states[state % layers]) {
+            states.push_back(state);
         }
-        std::cout << "===============================" << std::endl;
+        states.push_back(start_state);
+        std::reverse(states.begin(), states.end());
+
+        for (size_t i = 0; i < states.size(); ++i) {
+            uint64_t tile = states[i] / layers;
+            Position pos(static_cast<int>(tile % width), static_cast<int>(tile / width));
+            result.path.push_back(pos);
+            if (i > 0 && states[i] % layers < states[i - 1] % layers) {
+                bomb_result.blast_positions.push_back(pos);
+            }
+        }
+
+        result.total_cost = labels.at(goal_state / layers).g_costs[goal_state % layers];
+        result.path_found = true;
+        bomb_result.bombs_used = bombs - static_cast<int>(goal_state % layers);
+
+        if (verbose_) {
+            std::cout << "Path found! Cost: " << result.total_cost << ", Bombs used: "
+                      << bomb_result.bombs_used << std::endl;
+        }
+    } else if (verbose_) {
+        std::cout << "No path found to goal, even with bombs!" << std::endl;
     }
+
+    stats.bytes_allocated = labels.size() * sizeof(TileLabels) +
+                            EstimateHashContainerBytes(labels) +
+                            stats.peak_open_size * sizeof(QueueEntry);
+
+    FinishSearch(result, "A* (bombs)", start, goal, game_map, start_time);
+    return bomb_result;
 }
 
-// ******************** PRIVATE HELPER METHODS ********************
+// ******************** NEAREST-TARGET SEARCH ********************
 
-float Pathfinding::CalculateHeuristic(const Position& from, const Position& to) const {
-    // Manhattan distance heuristic (good for grid-based maps)
-    return static_cast<float>(std::abs(from.x - to.x) + std::abs(from.y - to.y));
+template<typename TileContainer>
+PathResult Pathfinding::FindNearest(const Position& start, const TilePredicate& is_target,
+                                    const Map<TileContainer>& game_map) {
+    std::vector<PathResult> found;
+    return RunNearestSearch(start, 1, &is_target, nullptr, "Nearest", game_map, found);
 }
 
-float Pathfinding::CalculateDistance(const Position& from, const Position& to) const {
-    // For grid movement, use Manhattan distance as actual cost
-    return static_cast<float>(std::abs(from.x - to.x) + std::abs(from.y - to.y));
+template<typename TileContainer>
+PathResult Pathfinding::FindNearest(const Position& start, const std::vector<Position>& targets,
+                                    const Map<TileContainer>& game_map) {
+    std::vector<PathResult> found;
+    return RunNearestSearch(start, 1, nullptr, &targets, "Nearest", game_map, found);
 }
 
-std::vector<Position> Pathfinding::ReconstructPath(PathNode* goal_node) const {
-    std::vector<Position> path;
-    PathNode* current = goal_node;
+template<typename TileContainer>
+std::vector<PathResult> Pathfinding::FindKNearest(const Position& start, const std::vector<Position>& targets,
+                                                  int k, const Map<TileContainer>& game_map) {
+    std::vector<PathResult> found;
+    RunNearestSearch(start, k, nullptr, &targets, "k-Nearest", game_map, found);
+    return found;
+}
 
-    while (current != nullptr) {
-        path.push_back(current->position);
-        current = current->parent;
+template<typename TileContainer>
+std::vector<PathResult> Pathfinding::FindKNearestItems(const Position& start, int k,
+                                                       const Map<TileContainer>& game_map) {
+    // Several items can share a tile; the workspace marks each tile once
+    std::vector<Position> targets;
+    for (const auto& item_with_pos : game_map.GetItemManager().GetAllItems()) {
+        targets.push_back(item_with_pos.position);
     }
-
-    // Reverse to get path from start to goal
-    std::reverse(path.begin(), path.end());
-    return path;
+    return FindKNearest(start, targets, k, game_map);
 }
 
 template<typename TileContainer>
-std::vector<Position> Pathfinding::GetNeighbors(const Position& pos, const Map<TileContainer>& game_map) const {
-    std::vector<Position> neighbors;
+PathResult Pathfinding::RunNearestSearch(const Position& start, int k, const TilePredicate* is_target,
+                                         const std::vector<Position>* targets, const char* algorithm,
+                                         const Map<TileContainer>& game_map, std::vector<PathResult>& found) {
+    auto start_time = std::chrono::steady_clock::now();
+
+    PathResult nearest;
+    SearchStats& stats = nearest.stats;
+    found.clear();
+
+    if (k <= 0 || !IsValidMove(start, game_map)) {
+        if (verbose_ && k > 0) std::cout << "Invalid start position for " << algorithm << " search!" << std::endl;
+        FinishSearch(nearest, algorithm, start, start, game_map, start_time);
+        return nearest;
+    }
 
-    // 4-directional movement (up, right, down, left)
-    const int dx[] = {0, 1, 0, -1};
-    const int dy[] = {-1, 0, 1, 0};
+    if (!search_workspace_) {
+        search_workspace_ = std::make_unique<SearchWorkspace>();
+    }
+    SearchWorkspace& workspace = *search_workspace_;
+    workspace.BeginSearch(game_map.GetWidth(), game_map.GetHeight(), IsStreamedTileContainer<TileContainer>::value);
 
-    for (int i = 0; i < 4; ++i) {
-        Position neighbor(pos.x + dx[i], pos.y + dy[i]);
-        if (game_map.IsValidPosition(neighbor)) {
-            neighbors.push_back(neighbor);
+    if (targets) {
+        for (const Position& target : *targets) {
+            if (game_map.IsValidPosition(target)) {
+                workspace.MarkTarget(workspace.GetIndex(target));
+            }
         }
     }
 
-    return neighbors;
-}
+    // Every step costs the same, so first-in-first-out order is distance order
+    std::vector<int64_t>& frontier = workspace.GetFrontier();
+    int64_t start_index = workspace.GetIndex(start);
+    workspace.Visit(start_index, 0, -1);
+    frontier.push_back(start_index);
+    stats.pushes++;
+    stats.peak_open_size = 1;
+
+    std::vector<int64_t> found_indices;
+    size_t head = 0;
+    while (head < frontier.size() && static_cast<int>(found_indices.size()) < k) {
+        int64_t index = frontier[head++];
+        stats.pops++;
+        stats.peak_closed_size = static_cast<int>(head);
+        nearest.nodes_explored++;
+
+        Position current = workspace.GetPosition(index);
+        bool is_match = is_target ? (*is_target)(current, game_map.GetTile(current)) : workspace.IsTarget(index);
+        if (is_match) {
+            found_indices.push_back(index);
+        }
 
-template<typename TileContainer>
-bool Pathfinding::IsValidMove(const Position& pos, const Map<TileContainer>& game_map) const {
-    if (!game_map.IsValidPosition(pos)) {
-        return false;
+        // Targets are expanded as well; the next target may lie behind this one
+        auto is_open = [&](const Position& pos) { return IsValidMove(pos, game_map); };
+        FourWayMovement::ForEachNeighbor(current, is_open, [&](const Position& neighbor_pos, float) {
+            int64_t neighbor = workspace.GetIndex(neighbor_pos);
+            if (workspace.IsVisited(neighbor)) {
+                return;
+            }
+
+            workspace.Visit(neighbor, workspace.GetDistance(index) + 1, index);
+            frontier.push_back(neighbor);
+            stats.pushes++;
+        });
+        stats.peak_open_size = std::max(stats.peak_open_size, static_cast<int>(frontier.size() - head));
     }
 
-    const Tile& tile = game_map.GetTile(pos);
-    return tile.IsTraversable();
-}
+    stats.bytes_allocated = workspace.GetBytesAllocated();
 
-bool Pathfinding::PositionsEqual(const Position& a, const Position& b) const {
-    return a.x == b.x && a.y == b.y;
-}
+    for (int64_t index : found_indices) {
+        PathResult result;
+        result.path = workspace.ReconstructPath(index);
+        result.total_cost = static_cast<float>(workspace.GetDistance(index));
+        result.nodes_explored = nearest.nodes_explored;
+        result.path_found = true;
+        found.push_back(result);
+    }
 
-std::string Pathfinding::PositionToString(const Position& pos) const {
-    return "(" + std::to_string(pos.x) + "," + std::to_string(pos.y) + ")";
+    Position goal = start;
+    if (!found.empty()) {
+        goal = found.front().path.back();
+        nearest.path = found.front().path;
+        nearest.total_cost = found.front().total_cost;
+        nearest.path_found = true;
+    }
+
+    if (verbose_) {
+        if (found.empty()) {
+            std::cout << algorithm << ": no target reachable from " << PositionToString(start) << std::endl;
+        } else {
+            std::cout << algorithm << ": " << found.size() << " target(s) found, nearest at "
+                      << PositionToString(goal) << " (cost " << nearest.total_cost << "), "
+                      << nearest.nodes_explored << " tiles expanded" << std::endl;
+        }
+    }
+
+    FinishSearch(nearest, algorithm, start, goal, game_map, start_time);
+    for (PathResult& result : found) {
+        result.stats = stats;
+    }
+    return nearest;
 }
 
-// ******************** DEMONSTRATION METHODS ********************
+// ******************** REACHABILITY ********************
 
 template<typename TileContainer>
-void Pathfinding::DemoPathfinding(const Map<TileContainer>& game_map) const {
-    std::cout << "\n" << std::string(50, '=') << std::endl;
-    std::cout << "           PATHFINDING DEMONSTRATION" << std::endl;
-    std::cout << std::string(50, '=') << std::endl;
+ReachableSet Pathfinding::ReachableWithin(const Position& start, int max_cost, const Map<TileContainer>& game_map) {
+    auto start_time = std::chrono::steady_clock::now();
 
-    Position start = game_map.GetStartPosition();
-    Position goal = game_map.GetEndPosition();
+    ReachableSet reachable;
+    SearchStats& stats = reachable.stats;
+    reachable.origin = start;
+    reachable.max_cost = max_cost;
 
-    std::cout << "Map size: " << game_map.GetWidth() << "x" << game_map.GetHeight() << std::endl;
-    std::cout << "Finding path from START to END..." << std::endl;
+    if (max_cost < 0 || !IsValidMove(start, game_map)) {
+        FinishSearch(stats, false, "Reachable", start, start, game_map, start_time);
+        return reachable;
+    }
 
-    // Create a non-const copy of this for the algorithm call
-    Pathfinding* pathfinder = const_cast<Pathfinding*>(this);
-    PathResult result = pathfinder->FindPathAStar(start, goal, game_map);
-    pathfinder->PrintPathDetails(result);
+    if (!search_workspace_) {
+        search_workspace_ = std::make_unique<SearchWorkspace>();
+    }
+    SearchWorkspace& workspace = *search_workspace_;
+    workspace.BeginSearch(game_map.GetWidth(), game_map.GetHeight(), IsStreamedTileContainer<TileContainer>::value);
+
+    // The frontier is visited in distance order, so it doubles as the result list
+    std::vector<int64_t>& frontier = workspace.GetFrontier();
+    int64_t start_index = workspace.GetIndex(start);
+    workspace.Visit(start_index, 0, -1);
+    frontier.push_back(start_index);
+    stats.pushes++;
+
+    auto is_open = [&](const Position& pos) { return IsValidMove(pos, game_map); };
+    size_t head = 0;
+    while (head < frontier.size()) {
+        int64_t index = frontier[head++];
+        stats.pops++;
+        reachable.nodes_explored++;
+
+        int next_cost = workspace.GetDistance(index) + 1;
+        if (next_cost > max_cost) {
+            continue; // On the radius: nothing beyond it is needed
+        }
 
-    if (result.path_found) {
-        std::cout << "\n🎉 SUCCESS: A* found the shortest path!" << std::endl;
-        std::cout << "Algorithm efficiency: " << result.nodes_explored << " nodes explored" << std::endl;
-        std::cout << "Path optimality: " << result.total_cost << " total movement cost" << std::endl;
-    } else {
-        std::cout << "\n❌ FAILURE: No path exists between start and end!" << std::endl;
+        Position current = workspace.GetPosition(index);
+        FourWayMovement::ForEachNeighbor(current, is_open, [&](const Position& neighbor_pos, float) {
+            int64_t neighbor = workspace.GetIndex(neighbor_pos);
+            if (workspace.IsVisited(neighbor)) {
+                return;
+            }
+
+            workspace.Visit(neighbor, next_cost, index);
+            frontier.push_back(neighbor);
+            stats.pushes++;
+        });
+        stats.peak_open_size = std::max(stats.peak_open_size, static_cast<int>(frontier.size() - head));
     }
 
-    std::cout << std::string(50, '=') << std::endl;
-}
+    // The bits cover the bounding box of the reached tiles, not the map
+    Position box_min = start;
+    Position box_max = start;
+    reachable.tiles.reserve(frontier.size());
+    reachable.costs.reserve(frontier.size());
+    for (int64_t index : frontier) {
+        Position pos = workspace.GetPosition(index);
+        reachable.tiles.push_back(pos);
+        reachable.costs.push_back(workspace.GetDistance(index));
+        box_min = Position(std::min(box_min.x, pos.x), std::min(box_min.y, pos.y));
+        box_max = Position(std::max(box_max.x, pos.x), std::max(box_max.y, pos.y));
+    }
+    reachable.bits_origin = box_min;
+    reachable.width = box_max.x - box_min.x + 1;
+    reachable.height = box_max.y - box_min.y + 1;
+    reachable.bits.assign((static_cast<size_t>(reachable.width) * reachable.height + 63) / 64, 0);
+    for (const Position& pos : reachable.tiles) {
+        size_t bit = static_cast<size_t>(pos.y - box_min.y) * reachable.width + (pos.x - box_min.x);
+        reachable.bits[bit / 64] |= uint64_t(1) << (bit % 64);
+    }
+    stats.peak_closed_size = static_cast<int>(frontier.size());
+    stats.bytes_allocated = workspace.GetBytesAllocated() + reachable.bits.size() * sizeof(uint64_t) +
+                            reachable.tiles.size() * (sizeof(Position) + sizeof(int));
+
+    if (verbose_) {
+        std::cout << reachable.tiles.size() << " tiles reachable within " << max_cost << " steps of "
+                  << PositionToString(start) << std::endl;
+    }
+
+    FinishSearch(stats, true, "Reachable", start, start, game_map, start_time);
+    return reachable;
+}
+
+// ******************** PARETO SEARCH ********************
+
+template<typename TileContainer>
+ParetoResult Pathfinding::FindParetoPaths(const Position& start, const Position& goal,
+                                          const Map<TileContainer>& game_map, int step_budget,
+                                          int max_labels_per_tile) {
+    if (IsStreamedTileContainer<TileContainer>::value) {
+        if (verbose_) std::cout << "Pareto search needs the whole map; not available on streamed maps" << std::endl;
+        return ParetoResult();
+    }
+
+    if (!pareto_search_) {
+        pareto_search_ = std::make_unique<ParetoSearch>();
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    if (verbose_) {
+        std::cout << "Starting Pareto search from " << PositionToString(start)
+                  << " to " << PositionToString(goal) << std::endl;
+    }
+
+    ParetoResult result = pareto_search_->FindFront(game_map, start, goal, step_budget, max_labels_per_tile);
+
+    if (verbose_) {
+        if (result.front.empty()) {
+            std::cout << "Pareto: No path found." << std::endl;
+        } else {
+            std::cout << "Pareto front: " << result.front.size() << " route(s) within " << result.step_budget
+                      << " steps, " << pareto_search_->GetLootTileCount() << " loot tiles, "
+                      << result.nodes_explored << " labels expanded" << std::endl;
+            for (const ParetoPath& route : result.front) {
+                std::cout << "  " << route.steps << " steps, value " << route.value << std::endl;
+            }
+            if (result.truncated) {
+                std::cout << "  (label limit reached, the front may be incomplete)" << std::endl;
+            }
+        }
+    }
+
+    FinishSearch(result.stats, !result.front.empty(), "Pareto", start, goal, game_map, start_time);
+    return result;
+}
+
+const ParetoPath* Pathfinding::SelectParetoRoute(const ParetoResult& result, RoutePolicy policy) {
+    if (result.front.empty()) {
+        return nullptr;
+    }
+
+    switch (policy) {
+        case RoutePolicy::SHORTEST: return &result.front.front();
+        case RoutePolicy::MOST_VALUE: return &result.front.back();
+        case RoutePolicy::BEST_VALUE_PER_EXTRA_STEP: {
+            // Steps grow strictly along the front, so every later route has extra steps
+            const ParetoPath& shortest = result.front.front();
+            const ParetoPath* best = &shortest;
+            float best_ratio = 0.0f;
+            for (size_t i = 1; i < result.front.size(); ++i) {
+                const ParetoPath& route = result.front[i];
+                float ratio = static_cast<float>(route.value - shortest.value) / (route.steps - shortest.steps);
+                if (ratio > best_ratio) {
+                    best_ratio = ratio;
+                    best = &route;
+                }
+            }
+            return best;
+        }
+        default: return &result.front.front();
+    }
+}
+
+// ******************** SUBGOAL GRAPH SEARCH ********************
+
+template<typename TileContainer>
+PathResult Pathfinding::FindPathSubgoalGraph(const Position& start, const Position& goal,
+                                             const Map<TileContainer>& game_map) {
+    if (!terrain_costs_->IsUniform()) {
+        if (verbose_) std::cout << "SUB assumes unit costs; using A* for weighted terrain" << std::endl;
+        return FindPathAStar(start, goal, game_map);
+    }
+    if (IsStreamedTileContainer<TileContainer>::value) {
+        if (verbose_) std::cout << "SUB needs the whole map; using A* for a streamed map" << std::endl;
+        return FindPathAStar(start, goal, game_map);
+    }
+
+    if (!subgoal_graph_) {
+        subgoal_graph_ = std::make_unique<SubgoalGraph>();
+    }
+
+    // Preprocessing (full build or replaying tile changes) is not part of the query time
+    subgoal_graph_->Synchronize(game_map);
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    if (verbose_) {
+        std::cout << "Starting SUB pathfinding from " << PositionToString(start)
+                  << " to " << PositionToString(goal) << std::endl;
+        subgoal_graph_->PrintGraphInfo();
+    }
+
+    PathResult result = subgoal_graph_->FindPath(start, goal);
+
+    if (verbose_) {
+        if (result.path_found) {
+            std::cout << "SUB path found! Length: " << result.path.size()
+                      << ", Cost: " << result.total_cost
+                      << ", Subgoals explored: " << result.nodes_explored << std::endl;
+        } else {
+            std::cout << "SUB: No path found." << std::endl;
+        }
+    }
+
+    FinishSearch(result, "SUB", start, goal, game_map, start_time);
+    return result;
+}
+
+// ******************** RECTANGULAR SYMMETRY REDUCTION SEARCH ********************
+
+template<typename TileContainer>
+PathResult Pathfinding::FindPathRectangleSymmetry(const Position& start, const Position& goal,
+                                                  const Map<TileContainer>& game_map) {
+    if (!terrain_costs_->IsUniform()) {
+        if (verbose_) std::cout << "RSR assumes unit costs; using A* for weighted terrain" << std::endl;
+        return FindPathAStar(start, goal, game_map);
+    }
+    if (IsStreamedTileContainer<TileContainer>::value) {
+        if (verbose_) std::cout << "RSR needs the whole map; using A* for a streamed map" << std::endl;
+        return FindPathAStar(start, goal, game_map);
+    }
+
+    if (!rectangle_reduction_) {
+        rectangle_reduction_ = std::make_unique<RectangleSymmetryReduction>();
+    }
+
+    // The decomposition is rebuilt only when the map changed, never per query
+    rectangle_reduction_->Synchronize(game_map);
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    if (verbose_) {
+        std::cout << "Starting RSR pathfinding from " << PositionToString(start)
+                  << " to " << PositionToString(goal) << std::endl;
+        rectangle_reduction_->PrintDecompositionInfo();
+    }
+
+    PathResult result = rectangle_reduction_->FindPath(start, goal);
+
+    if (verbose_) {
+        if (result.path_found) {
+            std::cout << "RSR path found! Length: " << result.path.size()
+                      << ", Cost: " << result.total_cost
+                      << ", Nodes explored: " << result.nodes_explored << std::endl;
+        } else {
+            std::cout << "RSR: No path found." << std::endl;
+        }
+    }
+
+    FinishSearch(result, "RSR", start, goal, game_map, start_time);
+    return result;
+}
+
+// ******************** MEMORY-BOUNDED SEARCH ********************
+
+template<typename TileContainer>
+PathResult Pathfinding::FindPathIDAStar(const Position& start, const Position& goal,
+                                        const Map<TileContainer>& game_map, int transposition_entries) {
+    if (!terrain_costs_->IsUniform()) {
+        if (verbose_) std::cout << "IDA* assumes unit costs; using A* for weighted terrain" << std::endl;
+        return FindPathAStar(start, goal, game_map);
+    }
+
+    if (!memory_bounded_search_) {
+        memory_bounded_search_ = std::make_unique<MemoryBoundedSearch>();
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    if (verbose_) {
+        std::cout << "Starting IDA* pathfinding from " << PositionToString(start)
+                  << " to " << PositionToString(goal) << " (" << transposition_entries
+                  << " transposition entries)" << std::endl;
+    }
+
+    PathResult result = memory_bounded_search_->FindPathIDAStar(game_map, start, goal, transposition_entries);
+
+    if (verbose_) {
+        if (result.path_found) {
+            std::cout << "IDA* path found! Length: " << result.path.size()
+                      << ", Cost: " << result.total_cost
+                      << ", Nodes explored: " << result.nodes_explored
+                      << ", Iterations: " << memory_bounded_search_->GetIterations() << std::endl;
+        } else {
+            std::cout << "IDA*: No path found." << std::endl;
+        }
+    }
+
+    FinishSearch(result, "IDA*", start, goal, game_map, start_time);
+    return result;
+}
+
+template<typename TileContainer>
+PathResult Pathfinding::FindPathSMAStar(const Position& start, const Position& goal,
+                                        const Map<TileContainer>& game_map, int node_budget) {
+    if (!terrain_costs_->IsUniform()) {
+        if (verbose_) std::cout << "SMA* assumes unit costs; using A* for weighted terrain" << std::endl;
+        return FindPathAStar(start, goal, game_map);
+    }
+
+    if (!memory_bounded_search_) {
+        memory_bounded_search_ = std::make_unique<MemoryBoundedSearch>();
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    if (verbose_) {
+        std::cout << "Starting SMA* pathfinding from " << PositionToString(start)
+                  << " to " << PositionToString(goal) << " (" << node_budget << " nodes)" << std::endl;
+    }
+
+    PathResult result = memory_bounded_search_->FindPathSMAStar(game_map, start, goal, node_budget);
+
+    if (verbose_) {
+        if (result.path_found) {
+            std::cout << "SMA* path found! Length: " << result.path.size()
+                      << ", Cost: " << result.total_cost
+                      << ", Nodes explored: " << result.nodes_explored
+                      << ", Nodes forgotten: " << memory_bounded_search_->GetForgottenNodes() << std::endl;
+        } else {
+            std::cout << "SMA*: No path found within the node budget." << std::endl;
+        }
+    }
+
+    FinishSearch(result, "SMA*", start, goal, game_map, start_time);
+    return result;
+}
+
+// ******************** TERRAIN COSTS ********************
+
+void Pathfinding::SetTerrainCost(TileType type, float cost) {
+    terrain_costs_->SetCost(type, cost);
+}
+
+float Pathfinding::GetTerrainCost(TileType type) const {
+    return terrain_costs_->GetCost(type);
+}
+
+void Pathfinding::ResetTerrainCosts() {
+    terrain_costs_->ResetToUniform();
+}
+
+bool Pathfinding::HasUniformTerrainCosts() const {
+    return terrain_costs_->IsUniform();
+}
+
+void Pathfinding::PrintTerrainCosts() const {
+    terrain_costs_->PrintCostTable();
+}
+
+// ******************** ALGORITHM SELECTION ********************
+
+template<typename TileContainer>
+PathResult Pathfinding::FindPath(PathfindingAlgorithm algorithm, const Position& start, const Position& goal,
+                                 const Map<TileContainer>& game_map) {
+    switch (algorithm) {
+        case PathfindingAlgorithm::A_STAR: return FindPathAStar(start, goal, game_map);
+        case PathfindingAlgorithm::DIJKSTRA: return FindPathDijkstra(start, goal, game_map);
+        case PathfindingAlgorithm::SUBGOAL_GRAPH: return FindPathSubgoalGraph(start, goal, game_map);
+        case PathfindingAlgorithm::RECTANGULAR_SYMMETRY_REDUCTION:
+            return FindPathRectangleSymmetry(start, goal, game_map);
+        case PathfindingAlgorithm::IDA_STAR: return FindPathIDAStar(start, goal, game_map);
+        case PathfindingAlgorithm::SMA_STAR: return FindPathSMAStar(start, goal, game_map);
+        case PathfindingAlgorithm::A_STAR_OCTILE:
+            return FindPathAStarWithMovement<EightWayMovement<DiagonalRule::BOTH_SIDES_FREE>>(start, goal, game_map);
+        default: return FindPathAStar(start, goal, game_map);
+    }
+}
+
+const char* Pathfinding::GetAlgorithmName(PathfindingAlgorithm algorithm) {
+    switch (algorithm) {
+        case PathfindingAlgorithm::A_STAR: return "A*";
+        case PathfindingAlgorithm::DIJKSTRA: return "Dijkstra";
+        case PathfindingAlgorithm::SUBGOAL_GRAPH: return "SUB";
+        case PathfindingAlgorithm::RECTANGULAR_SYMMETRY_REDUCTION: return "RSR";
+        case PathfindingAlgorithm::IDA_STAR: return "IDA*";
+        case PathfindingAlgorithm::SMA_STAR: return "SMA*";
+        case PathfindingAlgorithm::A_STAR_OCTILE: return "A* (8-way)";
+        default: return "Unknown";
+    }
+}
+
+// ******************** STATISTICS HELPERS ********************
+
+template<typename TileContainer>
+void Pathfinding::FinishSearch(PathResult& result, const char* algorithm, const Position& start, const Position& goal,
+                               const Map<TileContainer>& game_map,
+                               std::chrono::steady_clock::time_point start_time) const {
+    FinishSearch(result.stats, result.path_found, algorithm, start, goal, game_map, start_time);
+}
+
+template<typename TileContainer>
+void Pathfinding::FinishSearch(SearchStats& stats, bool path_found, const char* algorithm, const Position& start,
+                               const Position& goal, const Map<TileContainer>& game_map,
+                               std::chrono::steady_clock::time_point start_time) const {
+    auto end_time = std::chrono::steady_clock::now();
+    stats.wall_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count();
+
+    SearchStatsAggregator::Record(algorithm, stats,
+                                  SearchQuery(start, goal, game_map.GetWidth(), game_map.GetHeight()));
+
+    if (verbose_) {
+        std::cout << algorithm << " completed in " << (stats.wall_time_ns / 1000) << " microseconds"
+                  << (path_found ? "" : " (no path)") << std::endl;
+    }
+}
+
+// ******************** UTILITY METHODS ********************
+
+void Pathfinding::PrintPath(const PathResult& result) const {
+    if (result.is_partial) {
+        std::cout << "Search limit reached: partial path of " << result.path.size() << " steps toward the goal ("
+                  << result.nodes_explored << " nodes explored)" << std::endl;
+        return;
+    }
+
+    if (!result.path_found) {
+        std::cout << "No path to print!" << std::endl;
+        return;
+    }
+
+    std::cout << "\n=== PATH FOUND ===" << std::endl;
+    std::cout << "Path length: " << result.path.size() << " steps" << std::endl;
+    std::cout << "Total cost: " << result.total_cost << std::endl;
+    std::cout << "Nodes explored: " << result.nodes_explored << std::endl;
+
+    std::cout << "Path: ";
+    for (size_t i = 0; i < result.path.size(); ++i) {
+        std::cout << "(" << result.path[i].x << "," << result.path[i].y << ")";
+        if (i < result.path.size() - 1) {
+            std::cout << " -> ";
+        }
+    }
+    std::cout << std::endl;
+    std::cout << "==================" << std::endl;
+}
+
+void Pathfinding::PrintPathDetails(const PathResult& result) const {
+    PrintPath(result);
+
+    if (result.path_found && result.path.size() > 1) {
+        std::cout << "\n=== DETAILED PATH ANALYSIS ===" << std::endl;
+        for (size_t i = 0; i < result.path.size(); ++i) {
+            std::cout << "Step " << i << ": (" << result.path[i].x << ", " << result.path[i].y << ")";
+            if (i == 0) {
+                std::cout << " [START]";
+            } else if (i == result.path.size() - 1) {
+                std::cout << " [GOAL]";
+            }
+            std::cout << std::endl;
+        }
+        std::cout << "===============================" << std::endl;
+    }
+}
+
+void Pathfinding::PrintSearchStats(const PathResult& result) const {
+    const SearchStats& stats = result.stats;
+
+    std::cout << "\n=== SEARCH STATISTICS ===" << std::endl;
+    std::cout << "Wall time: " << stats.wall_time_ns << " ns" << std::endl;
+    std::cout << "Pushes: " << stats.pushes << " | Pops: " << stats.pops
+              << " | Stale pops: " << stats.stale_pops << " | Reopens: " << stats.reopens << std::endl;
+    std::cout << "Peak open set: " << stats.peak_open_size
+              << " | Peak closed set: " << stats.peak_closed_size << std::endl;
+    std::cout << "Bytes allocated: " << stats.bytes_allocated << std::endl;
+    std::cout << "=========================" << std::endl;
+}
+
+// ******************** PRIVATE HELPER METHODS ********************
+
+float Pathfinding::CalculateHeuristic(const Position& from, const Position& to) const {
+    // Manhattan distance heuristic (good for grid-based maps)
+    return static_cast<float>(std::abs(from.x - to.x) + std::abs(from.y - to.y));
+}
+
+std::vector<Position> Pathfinding::ReconstructPath(PathNode* goal_node) const {
+    std::vector<Position> path;
+    PathNode* current = goal_node;
+
+    while (current != nullptr) {
+        path.push_back(current->position);
+        current = current->parent;
+    }
+
+    // Reverse to get path from start to goal
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+template<typename TileContainer>
+bool Pathfinding::IsValidMove(const Position& pos, const Map<TileContainer>& game_map) const {
+    if (!game_map.IsValidPosition(pos)) {
+        return false;
+    }
+
+    return game_map.GetTile(pos).IsTraversable();
+}
+
+bool Pathfinding::PositionsEqual(const Position& a, const Position& b) const {
+    return a.x == b.x && a.y == b.y;
+}
+
+std::string Pathfinding::PositionToString(const Position& pos) const {
+    return "(" + std::to_string(pos.x) + "," + std::to_string(pos.y) + ")";
+}
+
+// ******************** DEMONSTRATION METHODS ********************
+
+template<typename TileContainer>
+void Pathfinding::DemoPathfinding(const Map<TileContainer>& game_map) const {
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "           PATHFINDING DEMONSTRATION" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+
+    Position start = game_map.GetStartPosition();
+    Position goal = game_map.GetEndPosition();
+
+    std::cout << "Map size: " << game_map.GetWidth() << "x" << game_map.GetHeight() << std::endl;
+    std::cout << "Finding path from START to END..." << std::endl;
+
+    // Create a non-const copy of this for the algorithm call
+    Pathfinding* pathfinder = const_cast<Pathfinding*>(this);
+    PathResult result = pathfinder->FindPathAStar(start, goal, game_map);
+    pathfinder->PrintPathDetails(result);
+    pathfinder->PrintSearchStats(result);
+
+    if (result.path_found) {
+        std::cout << "\n🎉 SUCCESS: A* found the shortest path!" << std::endl;
+        std::cout << "Algorithm efficiency: " << result.nodes_explored << " nodes explored" << std::endl;
+        std::cout << "Path optimality: " << result.total_cost << " total movement cost" << std::endl;
+    } else {
+        std::cout << "\n❌ FAILURE: No path exists between start and end!" << std::endl;
+    }
+
+    // Nearest targets from the start: one expansion each instead of one A* per candidate
+    std::cout << "\nNearest targets from START:" << std::endl;
+    PathResult chest_result = pathfinder->FindNearest(start, [](const Position&, const Tile& tile) {
+        return tile.IsClosedTreasureChest();
+    }, game_map);
+    if (chest_result.path_found) {
+        std::cout << "  Closed treasure chest at " << PositionToString(chest_result.path.back())
+                  << ", " << chest_result.total_cost << " steps away" << std::endl;
+    } else {
+        std::cout << "  No closed treasure chest reachable" << std::endl;
+    }
+
+    std::vector<PathResult> item_results = pathfinder->FindKNearestItems(start, 3, game_map);
+    for (const PathResult& item_result : item_results) {
+        std::cout << "  Item at " << PositionToString(item_result.path.back())
+                  << ", " << item_result.total_cost << " steps away" << std::endl;
+    }
+
+    // Routes trading extra steps for loot along the way
+    std::cout << "\nDistance vs. loot value (Pareto front):" << std::endl;
+    bool was_verbose = verbose_;
+    pathfinder->SetVerbose(false);
+    ParetoResult pareto_result = pathfinder->FindParetoPaths(start, goal, game_map);
+    pathfinder->SetVerbose(was_verbose);
+    for (const ParetoPath& route : pareto_result.front) {
+        std::cout << "  " << route.steps << " steps, value " << route.value << std::endl;
+    }
+    const ParetoPath* balanced_route = SelectParetoRoute(pareto_result, RoutePolicy::BEST_VALUE_PER_EXTRA_STEP);
+    if (balanced_route) {
+        std::cout << "  Best value per extra step: " << balanced_route->steps << " steps, value "
+                  << balanced_route->value << std::endl;
+    }
+
+    std::cout << std::string(50, '=') << std::endl;
+}
 
 template<typename TileContainer>
 void Pathfinding::CompareAlgorithms(const Map<TileContainer>& game_map) const {
@@ -390,19 +1473,44 @@ void Pathfinding::CompareAlgorithms(const Map<TileContainer>& game_map) const {
     std::cout << "\n>>> TESTING DIJKSTRA ALGORITHM <<<" << std::endl;
     PathResult dijkstra_result = pathfinder->FindPathDijkstra(start, goal, game_map);
 
+    // Test subgoal graph search
+    std::cout << "\n>>> TESTING SUBGOAL GRAPH (SUB) <<<" << std::endl;
+    PathResult subgoal_result = pathfinder->FindPathSubgoalGraph(start, goal, game_map);
+
+    // Test rectangular symmetry reduction
+    std::cout << "\n>>> TESTING RECTANGULAR SYMMETRY REDUCTION (RSR) <<<" << std::endl;
+    PathResult rectangle_result = pathfinder->FindPathRectangleSymmetry(start, goal, game_map);
+
+    // Test the memory-bounded searches
+    std::cout << "\n>>> TESTING IDA* <<<" << std::endl;
+    PathResult ida_result = pathfinder->FindPathIDAStar(start, goal, game_map);
+
+    std::cout << "\n>>> TESTING SMA* <<<" << std::endl;
+    PathResult sma_result = pathfinder->FindPathSMAStar(start, goal, game_map);
+
     // Compare results
     std::cout << "\n" << std::string(40, '-') << std::endl;
     std::cout << "           COMPARISON RESULTS" << std::endl;
     std::cout << std::string(40, '-') << std::endl;
 
-    std::cout << "Algorithm    | Nodes Explored | Path Cost | Path Found" << std::endl;
-    std::cout << "-------------|----------------|-----------|------------" << std::endl;
-    std::cout << "A*           | " << std::setw(14) << astar_result.nodes_explored
-              << " | " << std::setw(9) << astar_result.total_cost
-              << " | " << (astar_result.path_found ? "Yes" : "No") << std::endl;
-    std::cout << "Dijkstra     | " << std::setw(14) << dijkstra_result.nodes_explored
-              << " | " << std::setw(9) << dijkstra_result.total_cost
-              << " | " << (dijkstra_result.path_found ? "Yes" : "No") << std::endl;
+    std::cout << "Algorithm    | Nodes Explored | Path Cost | Time (us) | Memory (KB) | Path Found" << std::endl;
+    std::cout << "-------------|----------------|-----------|-----------|-------------|------------" << std::endl;
+    const std::pair<const char*, const PathResult*> rows[] = {
+            {"A*          ", &astar_result},
+            {"Dijkstra    ", &dijkstra_result},
+            {"SUB         ", &subgoal_result},
+            {"RSR         ", &rectangle_result},
+            {"IDA*        ", &ida_result},
+            {"SMA*        ", &sma_result}
+    };
+    for (const auto& row : rows) {
+        const PathResult& result = *row.second;
+        std::cout << row.first << " | " << std::setw(14) << result.nodes_explored
+                  << " | " << std::setw(9) << result.total_cost
+                  << " | " << std::setw(9) << (result.stats.wall_time_ns / 1000)
+                  << " | " << std::setw(11) << (result.stats.bytes_allocated / 1024)
+                  << " | " << (result.path_found ? "Yes" : "No") << std::endl;
+    }
 
     if (astar_result.path_found && dijkstra_result.path_found) {
         std::cout << "\n🏆 WINNER: ";
@@ -427,20 +1535,607 @@ void Pathfinding::CompareAlgorithms(const Map<TileContainer>& game_map) const {
 
 template PathResult Pathfinding::FindPathAStar<std::vector<std::vector<Tile>>>(
         const Position& start, const Position& goal,
-        const Map<std::vector<std::vector<Tile>>>& game_map);
+        const Map<std::vector<std::vector<Tile>>>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<FourWayMovement, std::vector<std::vector<Tile>>>(
+        const Position& start, const Position& goal,
+        const Map<std::vector<std::vector<Tile>>>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::ALWAYS>,
+                                                           std::vector<std::vector<Tile>>>(
+        const Position& start, const Position& goal,
+        const Map<std::vector<std::vector<Tile>>>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::ONE_SIDE_FREE>,
+                                                           std::vector<std::vector<Tile>>>(
+        const Position& start, const Position& goal,
+        const Map<std::vector<std::vector<Tile>>>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::BOTH_SIDES_FREE>,
+                                                           std::vector<std::vector<Tile>>>(
+        const Position& start, const Position& goal,
+        const Map<std::vector<std::vector<Tile>>>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<HexMovement, std::vector<std::vector<Tile>>>(
+        const Position& start, const Position& goal,
+        const Map<std::vector<std::vector<Tile>>>& game_map, const SearchLimits& limits);
 
 template PathResult Pathfinding::FindPathDijkstra<std::vector<std::vector<Tile>>>(
         const Position& start, const Position& goal,
         const Map<std::vector<std::vector<Tile>>>& game_map);
 
+template BombPathResult Pathfinding::FindPathWithBombs<std::vector<std::vector<Tile>>>(
+        const Position& start, const Position& goal,
+        const Map<std::vector<std::vector<Tile>>>& game_map, int bombs_available, float blast_cost);
+
+template PathResult Pathfinding::FindNearest<std::vector<std::vector<Tile>>>(
+        const Position& start, const TilePredicate& is_target, const Map<std::vector<std::vector<Tile>>>& game_map);
+
+template PathResult Pathfinding::FindNearest<std::vector<std::vector<Tile>>>(
+        const Position& start, const std::vector<Position>& targets,
+        const Map<std::vector<std::vector<Tile>>>& game_map);
+
+template std::vector<PathResult> Pathfinding::FindKNearest<std::vector<std::vector<Tile>>>(
+        const Position& start, const std::vector<Position>& targets, int k,
+        const Map<std::vector<std::vector<Tile>>>& game_map);
+
+template std::vector<PathResult> Pathfinding::FindKNearestItems<std::vector<std::vector<Tile>>>(
+        const Position& start, int k, const Map<std::vector<std::vector<Tile>>>& game_map);
+
+template ReachableSet Pathfinding::ReachableWithin<std::vector<std::vector<Tile>>>(
+        const Position& start, int max_cost, const Map<std::vector<std::vector<Tile>>>& game_map);
+
+template ParetoResult Pathfinding::FindParetoPaths<std::vector<std::vector<Tile>>>(
+        const Position& start, const Position& goal, const Map<std::vector<std::vector<Tile>>>& game_map,
+        int step_budget, int max_labels_per_tile);
+
+template PathResult Pathfinding::FindPathSubgoalGraph<std::vector<std::vector<Tile>>>(
+        const Position& start, const Position& goal,
+        const Map<std::vector<std::vector<Tile>>>& game_map);
+
+template PathResult Pathfinding::FindPathRectangleSymmetry<std::vector<std::vector<Tile>>>(
+        const Position& start, const Position& goal,
+        const Map<std::vector<std::vector<Tile>>>& game_map);
+
+template PathResult Pathfinding::FindPathIDAStar<std::vector<std::vector<Tile>>>(
+        const Position& start, const Position& goal,
+        const Map<std::vector<std::vector<Tile>>>& game_map, int transposition_entries);
+
+template PathResult Pathfinding::FindPathSMAStar<std::vector<std::vector<Tile>>>(
+        const Position& start, const Position& goal,
+        const Map<std::vector<std::vector<Tile>>>& game_map, int node_budget);
+
+template PathResult Pathfinding::FindPath<std::vector<std::vector<Tile>>>(
+        PathfindingAlgorithm algorithm, const Position& start, const Position& goal,
+        const Map<std::vector<std::vector<Tile>>>& game_map);
+
 template void Pathfinding::DemoPathfinding<std::vector<std::vector<Tile>>>(
         const Map<std::vector<std::vector<Tile>>>& game_map) const;
 
 template void Pathfinding::CompareAlgorithms<std::vector<std::vector<Tile>>>(
         const Map<std::vector<std::vector<Tile>>>& game_map) const;
 
-template std::vector<Position> Pathfinding::GetNeighbors<std::vector<std::vector<Tile>>>(
+template bool Pathfinding::IsValidMove<std::vector<std::vector<Tile>>>(
         const Position& pos, const Map<std::vector<std::vector<Tile>>>& game_map) const;
 
-template bool Pathfinding::IsValidMove<std::vector<std::vector<Tile>>>(
-        const Position& pos, const Map<std::vector<std::vector<Tile>>>& game_map) const;
\ No newline at end of file
+// Flat row-major grid (the default Map<> container)
+
+template PathResult Pathfinding::FindPathAStar<FlatTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<FlatTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<FourWayMovement, FlatTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<FlatTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::ALWAYS>,
+                                                           FlatTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<FlatTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::ONE_SIDE_FREE>,
+                                                           FlatTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<FlatTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::BOTH_SIDES_FREE>,
+                                                           FlatTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<FlatTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<HexMovement, FlatTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<FlatTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathDijkstra<FlatTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<FlatTileGrid>& game_map);
+
+template BombPathResult Pathfinding::FindPathWithBombs<FlatTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<FlatTileGrid>& game_map, int bombs_available, float blast_cost);
+
+template PathResult Pathfinding::FindNearest<FlatTileGrid>(
+        const Position& start, const TilePredicate& is_target, const Map<FlatTileGrid>& game_map);
+
+template PathResult Pathfinding::FindNearest<FlatTileGrid>(
+        const Position& start, const std::vector<Position>& targets,
+        const Map<FlatTileGrid>& game_map);
+
+template std::vector<PathResult> Pathfinding::FindKNearest<FlatTileGrid>(
+        const Position& start, const std::vector<Position>& targets, int k,
+        const Map<FlatTileGrid>& game_map);
+
+template std::vector<PathResult> Pathfinding::FindKNearestItems<FlatTileGrid>(
+        const Position& start, int k, const Map<FlatTileGrid>& game_map);
+
+template ReachableSet Pathfinding::ReachableWithin<FlatTileGrid>(
+        const Position& start, int max_cost, const Map<FlatTileGrid>& game_map);
+
+template ParetoResult Pathfinding::FindParetoPaths<FlatTileGrid>(
+        const Position& start, const Position& goal, const Map<FlatTileGrid>& game_map,
+        int step_budget, int max_labels_per_tile);
+
+template PathResult Pathfinding::FindPathSubgoalGraph<FlatTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<FlatTileGrid>& game_map);
+
+template PathResult Pathfinding::FindPathRectangleSymmetry<FlatTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<FlatTileGrid>& game_map);
+
+template PathResult Pathfinding::FindPathIDAStar<FlatTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<FlatTileGrid>& game_map, int transposition_entries);
+
+template PathResult Pathfinding::FindPathSMAStar<FlatTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<FlatTileGrid>& game_map, int node_budget);
+
+template PathResult Pathfinding::FindPath<FlatTileGrid>(
+        PathfindingAlgorithm algorithm, const Position& start, const Position& goal,
+        const Map<FlatTileGrid>& game_map);
+
+template void Pathfinding::DemoPathfinding<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map) const;
+
+template void Pathfinding::CompareAlgorithms<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map) const;
+
+template bool Pathfinding::IsValidMove<FlatTileGrid>(
+        const Position& pos, const Map<FlatTileGrid>& game_map) const;
+
+// Morton-ordered 8x8 blocks
+
+template PathResult Pathfinding::FindPathAStar<MortonTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MortonTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<FourWayMovement, MortonTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MortonTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::ALWAYS>,
+                                                           MortonTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MortonTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::ONE_SIDE_FREE>,
+                                                           MortonTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MortonTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::BOTH_SIDES_FREE>,
+                                                           MortonTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MortonTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<HexMovement, MortonTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MortonTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathDijkstra<MortonTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MortonTileGrid>& game_map);
+
+template BombPathResult Pathfinding::FindPathWithBombs<MortonTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MortonTileGrid>& game_map, int bombs_available, float blast_cost);
+
+template PathResult Pathfinding::FindNearest<MortonTileGrid>(
+        const Position& start, const TilePredicate& is_target, const Map<MortonTileGrid>& game_map);
+
+template PathResult Pathfinding::FindNearest<MortonTileGrid>(
+        const Position& start, const std::vector<Position>& targets,
+        const Map<MortonTileGrid>& game_map);
+
+template std::vector<PathResult> Pathfinding::FindKNearest<MortonTileGrid>(
+        const Position& start, const std::vector<Position>& targets, int k,
+        const Map<MortonTileGrid>& game_map);
+
+template std::vector<PathResult> Pathfinding::FindKNearestItems<MortonTileGrid>(
+        const Position& start, int k, const Map<MortonTileGrid>& game_map);
+
+template ReachableSet Pathfinding::ReachableWithin<MortonTileGrid>(
+        const Position& start, int max_cost, const Map<MortonTileGrid>& game_map);
+
+template ParetoResult Pathfinding::FindParetoPaths<MortonTileGrid>(
+        const Position& start, const Position& goal, const Map<MortonTileGrid>& game_map,
+        int step_budget, int max_labels_per_tile);
+
+template PathResult Pathfinding::FindPathSubgoalGraph<MortonTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MortonTileGrid>& game_map);
+
+template PathResult Pathfinding::FindPathRectangleSymmetry<MortonTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MortonTileGrid>& game_map);
+
+template PathResult Pathfinding::FindPathIDAStar<MortonTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MortonTileGrid>& game_map, int transposition_entries);
+
+template PathResult Pathfinding::FindPathSMAStar<MortonTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MortonTileGrid>& game_map, int node_budget);
+
+template PathResult Pathfinding::FindPath<MortonTileGrid>(
+        PathfindingAlgorithm algorithm, const Position& start, const Position& goal,
+        const Map<MortonTileGrid>& game_map);
+
+template void Pathfinding::DemoPathfinding<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map) const;
+
+template void Pathfinding::CompareAlgorithms<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map) const;
+
+template bool Pathfinding::IsValidMove<MortonTileGrid>(
+        const Position& pos, const Map<MortonTileGrid>& game_map) const;
+
+// Type byte plus bit planes
+
+template PathResult Pathfinding::FindPathAStar<CompactTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<CompactTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<FourWayMovement, CompactTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<CompactTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::ALWAYS>,
+                                                           CompactTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<CompactTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::ONE_SIDE_FREE>,
+                                                           CompactTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<CompactTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::BOTH_SIDES_FREE>,
+                                                           CompactTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<CompactTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<HexMovement, CompactTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<CompactTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathDijkstra<CompactTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<CompactTileGrid>& game_map);
+
+template BombPathResult Pathfinding::FindPathWithBombs<CompactTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<CompactTileGrid>& game_map, int bombs_available, float blast_cost);
+
+template PathResult Pathfinding::FindNearest<CompactTileGrid>(
+        const Position& start, const TilePredicate& is_target, const Map<CompactTileGrid>& game_map);
+
+template PathResult Pathfinding::FindNearest<CompactTileGrid>(
+        const Position& start, const std::vector<Position>& targets,
+        const Map<CompactTileGrid>& game_map);
+
+template std::vector<PathResult> Pathfinding::FindKNearest<CompactTileGrid>(
+        const Position& start, const std::vector<Position>& targets, int k,
+        const Map<CompactTileGrid>& game_map);
+
+template std::vector<PathResult> Pathfinding::FindKNearestItems<CompactTileGrid>(
+        const Position& start, int k, const Map<CompactTileGrid>& game_map);
+
+template ReachableSet Pathfinding::ReachableWithin<CompactTileGrid>(
+        const Position& start, int max_cost, const Map<CompactTileGrid>& game_map);
+
+template ParetoResult Pathfinding::FindParetoPaths<CompactTileGrid>(
+        const Position& start, const Position& goal, const Map<CompactTileGrid>& game_map,
+        int step_budget, int max_labels_per_tile);
+
+template PathResult Pathfinding::FindPathSubgoalGraph<CompactTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<CompactTileGrid>& game_map);
+
+template PathResult Pathfinding::FindPathRectangleSymmetry<CompactTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<CompactTileGrid>& game_map);
+
+template PathResult Pathfinding::FindPathIDAStar<CompactTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<CompactTileGrid>& game_map, int transposition_entries);
+
+template PathResult Pathfinding::FindPathSMAStar<CompactTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<CompactTileGrid>& game_map, int node_budget);
+
+template PathResult Pathfinding::FindPath<CompactTileGrid>(
+        PathfindingAlgorithm algorithm, const Position& start, const Position& goal,
+        const Map<CompactTileGrid>& game_map);
+
+template void Pathfinding::DemoPathfinding<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map) const;
+
+template void Pathfinding::CompareAlgorithms<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map) const;
+
+template bool Pathfinding::IsValidMove<CompactTileGrid>(
+        const Position& pos, const Map<CompactTileGrid>& game_map) const;
+
+// Build-time 64x64 grid
+
+template PathResult Pathfinding::FindPathAStar<FixedGrid<64, 64>>(
+        const Position& start, const Position& goal,
+        const Map<FixedGrid<64, 64>>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<FourWayMovement, FixedGrid<64, 64>>(
+        const Position& start, const Position& goal,
+        const Map<FixedGrid<64, 64>>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::ALWAYS>,
+                                                           FixedGrid<64, 64>>(
+        const Position& start, const Position& goal,
+        const Map<FixedGrid<64, 64>>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::ONE_SIDE_FREE>,
+                                                           FixedGrid<64, 64>>(
+        const Position& start, const Position& goal,
+        const Map<FixedGrid<64, 64>>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::BOTH_SIDES_FREE>,
+                                                           FixedGrid<64, 64>>(
+        const Position& start, const Position& goal,
+        const Map<FixedGrid<64, 64>>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<HexMovement, FixedGrid<64, 64>>(
+        const Position& start, const Position& goal,
+        const Map<FixedGrid<64, 64>>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathDijkstra<FixedGrid<64, 64>>(
+        const Position& start, const Position& goal,
+        const Map<FixedGrid<64, 64>>& game_map);
+
+template BombPathResult Pathfinding::FindPathWithBombs<FixedGrid<64, 64>>(
+        const Position& start, const Position& goal,
+        const Map<FixedGrid<64, 64>>& game_map, int bombs_available, float blast_cost);
+
+template PathResult Pathfinding::FindNearest<FixedGrid<64, 64>>(
+        const Position& start, const TilePredicate& is_target, const Map<FixedGrid<64, 64>>& game_map);
+
+template PathResult Pathfinding::FindNearest<FixedGrid<64, 64>>(
+        const Position& start, const std::vector<Position>& targets,
+        const Map<FixedGrid<64, 64>>& game_map);
+
+template std::vector<PathResult> Pathfinding::FindKNearest<FixedGrid<64, 64>>(
+        const Position& start, const std::vector<Position>& targets, int k,
+        const Map<FixedGrid<64, 64>>& game_map);
+
+template std::vector<PathResult> Pathfinding::FindKNearestItems<FixedGrid<64, 64>>(
+        const Position& start, int k, const Map<FixedGrid<64, 64>>& game_map);
+
+template ReachableSet Pathfinding::ReachableWithin<FixedGrid<64, 64>>(
+        const Position& start, int max_cost, const Map<FixedGrid<64, 64>>& game_map);
+
+template ParetoResult Pathfinding::FindParetoPaths<FixedGrid<64, 64>>(
+        const Position& start, const Position& goal, const Map<FixedGrid<64, 64>>& game_map,
+        int step_budget, int max_labels_per_tile);
+
+template PathResult Pathfinding::FindPathSubgoalGraph<FixedGrid<64, 64>>(
+        const Position& start, const Position& goal,
+        const Map<FixedGrid<64, 64>>& game_map);
+
+template PathResult Pathfinding::FindPathRectangleSymmetry<FixedGrid<64, 64>>(
+        const Position& start, const Position& goal,
+        const Map<FixedGrid<64, 64>>& game_map);
+
+template PathResult Pathfinding::FindPathIDAStar<FixedGrid<64, 64>>(
+        const Position& start, const Position& goal,
+        const Map<FixedGrid<64, 64>>& game_map, int transposition_entries);
+
+template PathResult Pathfinding::FindPathSMAStar<FixedGrid<64, 64>>(
+        const Position& start, const Position& goal,
+        const Map<FixedGrid<64, 64>>& game_map, int node_budget);
+
+template PathResult Pathfinding::FindPath<FixedGrid<64, 64>>(
+        PathfindingAlgorithm algorithm, const Position& start, const Position& goal,
+        const Map<FixedGrid<64, 64>>& game_map);
+
+template void Pathfinding::DemoPathfinding<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map) const;
+
+template void Pathfinding::CompareAlgorithms<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map) const;
+
+template bool Pathfinding::IsValidMove<FixedGrid<64, 64>>(
+        const Position& pos, const Map<FixedGrid<64, 64>>& game_map) const;
+
+// Streamed 64x64 chunks
+
+template PathResult Pathfinding::FindPathAStar<ChunkedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<ChunkedTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<FourWayMovement, ChunkedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<ChunkedTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::ALWAYS>,
+                                                           ChunkedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<ChunkedTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::ONE_SIDE_FREE>,
+                                                           ChunkedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<ChunkedTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::BOTH_SIDES_FREE>,
+                                                           ChunkedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<ChunkedTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<HexMovement, ChunkedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<ChunkedTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathDijkstra<ChunkedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<ChunkedTileGrid>& game_map);
+
+template BombPathResult Pathfinding::FindPathWithBombs<ChunkedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<ChunkedTileGrid>& game_map, int bombs_available, float blast_cost);
+
+template PathResult Pathfinding::FindNearest<ChunkedTileGrid>(
+        const Position& start, const TilePredicate& is_target, const Map<ChunkedTileGrid>& game_map);
+
+template PathResult Pathfinding::FindNearest<ChunkedTileGrid>(
+        const Position& start, const std::vector<Position>& targets,
+        const Map<ChunkedTileGrid>& game_map);
+
+template std::vector<PathResult> Pathfinding::FindKNearest<ChunkedTileGrid>(
+        const Position& start, const std::vector<Position>& targets, int k,
+        const Map<ChunkedTileGrid>& game_map);
+
+template std::vector<PathResult> Pathfinding::FindKNearestItems<ChunkedTileGrid>(
+        const Position& start, int k, const Map<ChunkedTileGrid>& game_map);
+
+template ReachableSet Pathfinding::ReachableWithin<ChunkedTileGrid>(
+        const Position& start, int max_cost, const Map<ChunkedTileGrid>& game_map);
+
+template ParetoResult Pathfinding::FindParetoPaths<ChunkedTileGrid>(
+        const Position& start, const Position& goal, const Map<ChunkedTileGrid>& game_map,
+        int step_budget, int max_labels_per_tile);
+
+template PathResult Pathfinding::FindPathSubgoalGraph<ChunkedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<ChunkedTileGrid>& game_map);
+
+template PathResult Pathfinding::FindPathRectangleSymmetry<ChunkedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<ChunkedTileGrid>& game_map);
+
+template PathResult Pathfinding::FindPathIDAStar<ChunkedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<ChunkedTileGrid>& game_map, int transposition_entries);
+
+template PathResult Pathfinding::FindPathSMAStar<ChunkedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<ChunkedTileGrid>& game_map, int node_budget);
+
+template PathResult Pathfinding::FindPath<ChunkedTileGrid>(
+        PathfindingAlgorithm algorithm, const Position& start, const Position& goal,
+        const Map<ChunkedTileGrid>& game_map);
+
+template void Pathfinding::DemoPathfinding<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map) const;
+
+template void Pathfinding::CompareAlgorithms<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map) const;
+
+template bool Pathfinding::IsValidMove<ChunkedTileGrid>(
+        const Position& pos, const Map<ChunkedTileGrid>& game_map) const;
+
+// Memory-mapped map file
+
+template PathResult Pathfinding::FindPathAStar<MappedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MappedTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<FourWayMovement, MappedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MappedTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::ALWAYS>,
+                                                           MappedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MappedTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::ONE_SIDE_FREE>,
+                                                           MappedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MappedTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<EightWayMovement<DiagonalRule::BOTH_SIDES_FREE>,
+                                                           MappedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MappedTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathAStarWithMovement<HexMovement, MappedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MappedTileGrid>& game_map, const SearchLimits& limits);
+
+template PathResult Pathfinding::FindPathDijkstra<MappedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MappedTileGrid>& game_map);
+
+template BombPathResult Pathfinding::FindPathWithBombs<MappedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MappedTileGrid>& game_map, int bombs_available, float blast_cost);
+
+template PathResult Pathfinding::FindNearest<MappedTileGrid>(
+        const Position& start, const TilePredicate& is_target, const Map<MappedTileGrid>& game_map);
+
+template PathResult Pathfinding::FindNearest<MappedTileGrid>(
+        const Position& start, const std::vector<Position>& targets,
+        const Map<MappedTileGrid>& game_map);
+
+template std::vector<PathResult> Pathfinding::FindKNearest<MappedTileGrid>(
+        const Position& start, const std::vector<Position>& targets, int k,
+        const Map<MappedTileGrid>& game_map);
+
+template std::vector<PathResult> Pathfinding::FindKNearestItems<MappedTileGrid>(
+        const Position& start, int k, const Map<MappedTileGrid>& game_map);
+
+template ReachableSet Pathfinding::ReachableWithin<MappedTileGrid>(
+        const Position& start, int max_cost, const Map<MappedTileGrid>& game_map);
+
+template ParetoResult Pathfinding::FindParetoPaths<MappedTileGrid>(
+        const Position& start, const Position& goal, const Map<MappedTileGrid>& game_map,
+        int step_budget, int max_labels_per_tile);
+
+template PathResult Pathfinding::FindPathSubgoalGraph<MappedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MappedTileGrid>& game_map);
+
+template PathResult Pathfinding::FindPathRectangleSymmetry<MappedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MappedTileGrid>& game_map);
+
+template PathResult Pathfinding::FindPathIDAStar<MappedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MappedTileGrid>& game_map, int transposition_entries);
+
+template PathResult Pathfinding::FindPathSMAStar<MappedTileGrid>(
+        const Position& start, const Position& goal,
+        const Map<MappedTileGrid>& game_map, int node_budget);
+
+template PathResult Pathfinding::FindPath<MappedTileGrid>(
+        PathfindingAlgorithm algorithm, const Position& start, const Position& goal,
+        const Map<MappedTileGrid>& game_map);
+
+template void Pathfinding::DemoPathfinding<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map) const;
+
+template void Pathfinding::CompareAlgorithms<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map) const;
+
+template bool Pathfinding::IsValidMove<MappedTileGrid>(
+        const Position& pos, const Map<MappedTileGrid>& game_map) const;
@@ -4,13 +4,26 @@
 
 
 #include "Tile.h"
+#include "SearchStats.h"
+#include "MovementModel.h"
 #include <vector>
 #include <queue>
 #include <unordered_map>
 #include <functional>
+#include <chrono>
+#include <memory>
+#include <cstdint>
 
-// Forward declaration
+// Forward declarations
 template<typename TileContainer> class Map;
+template<int Width, int Height> class FixedGrid;
+class SubgoalGraph;
+class RectangleSymmetryReduction;
+class DeadEndAnalysis;
+class SearchWorkspace;
+class ParetoSearch;
+class MemoryBoundedSearch;
+class TerrainCosts;
 
 // ******************** PATHFINDING NODE STRUCTURE ********************
 
@@ -20,12 +33,13 @@ struct PathNode {
     float h_cost;           // Heuristic distance to goal
     float f_cost;           // g_cost + h_cost
     PathNode* parent;       // For path reconstruction
+    bool closed;            // Expanded, and not reopened since
 
     PathNode(const Position& pos)
-            : position(pos), g_cost(0), h_cost(0), f_cost(0), parent(nullptr) {}
+            : position(pos), g_cost(0), h_cost(0), f_cost(0), parent(nullptr), closed(false) {}
 
     PathNode(const Position& pos, float g, float h, PathNode* p = nullptr)
-            : position(pos), g_cost(g), h_cost(h), f_cost(g + h), parent(p) {}
+            : position(pos), g_cost(g), h_cost(h), f_cost(g + h), parent(p), closed(false) {}
 };
 
 // ******************** PATH RESULT STRUCTURE ********************
@@ -35,8 +49,99 @@ struct PathResult {
     float total_cost;
     int nodes_explored;
     bool path_found;
+    bool is_partial;        // Search hit its limits; path ends at the expanded tile closest to the goal
+    SearchStats stats;      // Instrumentation for this query
 
-    PathResult() : total_cost(0), nodes_explored(0), path_found(false) {}
+    PathResult() : total_cost(0), nodes_explored(0), path_found(false), is_partial(false) {}
+};
+
+// ******************** SEARCH LIMITS ********************
+
+// Caps on the work of a single search; 0 means unlimited
+struct SearchLimits {
+    int max_expansions;
+    std::size_t max_bytes;  // Compared against the estimate reported in SearchStats::bytes_allocated
+
+    SearchLimits() : max_expansions(0), max_bytes(0) {}
+    explicit SearchLimits(int expansions, std::size_t bytes = 0) : max_expansions(expansions), max_bytes(bytes) {}
+
+    bool IsLimited() const { return max_expansions > 0 || max_bytes > 0; }
+};
+
+// ******************** BOMB PATH RESULT STRUCTURE ********************
+
+struct BombPathResult {
+    PathResult path_result;
+    std::vector<Position> blast_positions;  // Blocked tiles to clear, in path order
+    int bombs_used;
+
+    BombPathResult() : bombs_used(0) {}
+};
+
+// ******************** REACHABLE SET STRUCTURE ********************
+
+// Tiles within a step budget of an origin, e.g. for a movement-range overlay
+struct ReachableSet {
+    Position origin;
+    int max_cost;
+    std::vector<Position> tiles;    // Nearest first; tiles[0] is the origin
+    std::vector<int> costs;         // Steps to tiles[i]
+    std::vector<uint64_t> bits;     // One bit per tile of the box around the tiles, row-major
+    Position bits_origin;           // Top-left corner of that box
+    int width;                      // Box size
+    int height;
+    int nodes_explored;
+    SearchStats stats;
+
+    ReachableSet() : max_cost(0), width(0), height(0), nodes_explored(0) {}
+
+    bool Contains(const Position& pos) const {
+        int x = pos.x - bits_origin.x;
+        int y = pos.y - bits_origin.y;
+        if (x < 0 || y < 0 || x >= width || y >= height) return false;
+        size_t index = static_cast<size_t>(y) * width + x;
+        return ((bits[index / 64] >> (index % 64)) & 1) != 0;
+    }
+};
+
+// ******************** PARETO PATH STRUCTURES ********************
+
+// One route of a Pareto front: no other route is both shorter and worth more
+struct ParetoPath {
+    std::vector<Position> path;
+    int steps;
+    int value;              // Total ItemBase::GetValue() of the items passed over
+
+    ParetoPath() : steps(0), value(0) {}
+};
+
+struct ParetoResult {
+    std::vector<ParetoPath> front;  // Sorted by steps; the value grows along the front
+    int step_budget;
+    int nodes_explored;
+    bool truncated;                 // A label limit was hit, some routes may be missing
+    SearchStats stats;
+
+    ParetoResult() : step_budget(0), nodes_explored(0), truncated(false) {}
+};
+
+// How automation picks one route from a Pareto front
+enum class RoutePolicy {
+    SHORTEST,
+    MOST_VALUE,
+    BEST_VALUE_PER_EXTRA_STEP
+};
+
+// ******************** ALGORITHM SELECTION ********************
+
+enum class PathfindingAlgorithm {
+    A_STAR,
+    DIJKSTRA,
+    SUBGOAL_GRAPH,
+    RECTANGULAR_SYMMETRY_REDUCTION,
+    IDA_STAR,
+    SMA_STAR,
+    A_STAR_OCTILE       // 8-way A* without corner cutting, the MovingAI movement rules
 };
 
 // ******************** PATHFINDING ALGORITHMS CLASS ********************
@@ -50,18 +155,125 @@ public:
     ~Pathfinding();
 
     // A* Algorithm Implementation
+    // When a limit is hit the result is partial: path_found stays false and the path leads to the
+    // expanded tile with the lowest heuristic, so a caller can walk toward the goal and search again.
     template<typename TileContainer>
     PathResult FindPathAStar(const Position& start, const Position& goal,
-                             const Map<TileContainer>& game_map);
+                             const Map<TileContainer>& game_map, const SearchLimits& limits = SearchLimits());
+
+    // Terrain costs: entering a tile costs its type's entry in the table (1 for every type by default).
+    // A* and Dijkstra read them from a per-tile grid; SUB, RSR, IDA* and SMA* assume unit costs and
+    // fall back to A* while any cost differs from 1. The bomb search prices steps the same way; the
+    // nearest-target, reachability and Pareto searches keep counting steps.
+    void SetTerrainCost(TileType type, float cost);
+    float GetTerrainCost(TileType type) const;
+    void ResetTerrainCosts();
+    bool HasUniformTerrainCosts() const;
+    void PrintTerrainCosts() const;
+
+    // A* under a compile-time movement model from MovementModel.h (FindPathAStar uses FourWayMovement).
+    // Dead-end pruning only applies to 4-way movement.
+    template<typename Movement, typename TileContainer>
+    PathResult FindPathAStarWithMovement(const Position& start, const Position& goal,
+                                         const Map<TileContainer>& game_map, const SearchLimits& limits = SearchLimits());
 
     // Dijkstra algorithm implementation  (bonus -> for comparison)
     template<typename TileContainer>
     PathResult FindPathDijkstra(const Position& start, const Position& goal,
                                 const Map<TileContainer>& game_map);
 
+    // Search over a subgoal graph that is kept in sync with map changes
+    template<typename TileContainer>
+    PathResult FindPathSubgoalGraph(const Position& start, const Position& goal,
+                                    const Map<TileContainer>& game_map);
+
+    // A* over empty-rectangle perimeters (rectangular symmetry reduction)
+    template<typename TileContainer>
+    PathResult FindPathRectangleSymmetry(const Position& start, const Position& goal,
+                                         const Map<TileContainer>& game_map);
+
+    // Memory-bounded optimal searches for maps whose A* open and closed sets would not fit:
+    // IDA* with a fixed-size transposition table, and SMA* holding at most node_budget nodes
+    // (the budget must exceed the path length). Both trade repeated expansions for memory and
+    // run on streamed maps too.
+    static const int kDefaultTranspositionEntries = 1 << 16;
+    static const int kDefaultSmaNodeBudget = 1 << 16;
+
+    template<typename TileContainer>
+    PathResult FindPathIDAStar(const Position& start, const Position& goal, const Map<TileContainer>& game_map,
+                               int transposition_entries = kDefaultTranspositionEntries);
+
+    template<typename TileContainer>
+    PathResult FindPathSMAStar(const Position& start, const Position& goal, const Map<TileContainer>& game_map,
+                               int node_budget = kDefaultSmaNodeBudget);
+
+    // Search over (tile, bombs remaining): a bomb clears one BLOCKED_STONE or BLOCKED_BUSHES
+    // tile at blast_cost on top of the step. Steps use the terrain costs like A*, a blasted tile
+    // costing what the dirt it turns into costs. Labels with fewer bombs and no lower cost are pruned.
+    static const int kMaxPlannedBombs = 8;
+    template<typename TileContainer>
+    BombPathResult FindPathWithBombs(const Position& start, const Position& goal,
+                                     const Map<TileContainer>& game_map, int bombs_available,
+                                     float blast_cost = 4.0f);
+
+    // Nearest-target search: one breadth-first expansion from start that stops at the first
+    // matching tile instead of one A* per candidate. Steps cost 1 as in A*, so the returned
+    // path is a shortest one; path.back() is the target that was found.
+    using TilePredicate = std::function<bool(const Position&, const Tile&)>;
+
+    template<typename TileContainer>
+    PathResult FindNearest(const Position& start, const TilePredicate& is_target,
+                           const Map<TileContainer>& game_map);
+
+    template<typename TileContainer>
+    PathResult FindNearest(const Position& start, const std::vector<Position>& targets,
+                           const Map<TileContainer>& game_map);
+
+    // Paths to the k closest targets, nearest first (fewer if fewer are reachable)
+    template<typename TileContainer>
+    std::vector<PathResult> FindKNearest(const Position& start, const std::vector<Position>& targets, int k,
+                                         const Map<TileContainer>& game_map);
+
+    // Paths to the k closest item positions of the map's ItemManager
+    template<typename TileContainer>
+    std::vector<PathResult> FindKNearestItems(const Position& start, int k, const Map<TileContainer>& game_map);
+
+    // Every tile at most max_cost steps from start: a breadth-first search in the shared workspace
+    // that stops at the radius, instead of one A* per candidate tile (sparse on streamed maps)
+    template<typename TileContainer>
+    ReachableSet ReachableWithin(const Position& start, int max_cost, const Map<TileContainer>& game_map);
+
+    // Multi-objective search: the Pareto front of routes trading step count against the value of
+    // the items passed over. A step budget <= 0 allows twice the shortest distance; each loot tile
+    // keeps at most max_labels_per_tile non-dominated labels so memory stays predictable. Streamed
+    // maps are too large for its whole-map distances and get an empty front.
+    static const int kDefaultParetoLabelsPerTile = 64;
+    template<typename TileContainer>
+    ParetoResult FindParetoPaths(const Position& start, const Position& goal, const Map<TileContainer>& game_map,
+                                 int step_budget = 0, int max_labels_per_tile = kDefaultParetoLabelsPerTile);
+
+    // Picks one route of the front; nullptr when the front is empty
+    static const ParetoPath* SelectParetoRoute(const ParetoResult& result, RoutePolicy policy);
+
+    // Runs the selected algorithm
+    template<typename TileContainer>
+    PathResult FindPath(PathfindingAlgorithm algorithm, const Position& start, const Position& goal,
+                        const Map<TileContainer>& game_map);
+
+    static const char* GetAlgorithmName(PathfindingAlgorithm algorithm);
+
     // Utility methods
     void PrintPath(const PathResult& result) const;
     void PrintPathDetails(const PathResult& result) const;
+    void PrintSearchStats(const PathResult& result) const;
+
+    // A* skips dead-end pockets and swamps that hold neither start nor goal (on by default)
+    void SetDeadEndPruning(bool enabled) { dead_end_pruning_ = enabled; }
+    bool IsDeadEndPruningEnabled() const { return dead_end_pruning_; }
+
+    // Console output of the search algorithms (statistics are always collected)
+    void SetVerbose(bool verbose) { verbose_ = verbose; }
+    bool IsVerbose() const { return verbose_; }
 
     // Demonstration methods
     template<typename TileContainer>
@@ -71,17 +283,51 @@ public:
     void CompareAlgorithms(const Map<TileContainer>& game_map) const;
 
 private:
+    bool verbose_;
+    bool dead_end_pruning_;
+
+    // Preprocessed search structures (built on first use)
+    std::unique_ptr<SubgoalGraph> subgoal_graph_;
+    std::unique_ptr<RectangleSymmetryReduction> rectangle_reduction_;
+    std::unique_ptr<DeadEndAnalysis> dead_end_analysis_;
+
+    // Per-tile state shared by the nearest-target and reachability searches
+    std::unique_ptr<SearchWorkspace> search_workspace_;
+    std::unique_ptr<ParetoSearch> pareto_search_;
+    std::unique_ptr<MemoryBoundedSearch> memory_bounded_search_;
+    std::unique_ptr<TerrainCosts> terrain_costs_;
+
+    // FindPathAStarWithMovement for 4-way movement on build-time grids: the search state lives in a
+    // FixedSearchWorkspace on the stack instead of node hash maps
+    template<int Width, int Height>
+    PathResult FindPathAStarFixed(const Position& start, const Position& goal,
+                                  const Map<FixedGrid<Width, Height>>& game_map, const SearchLimits& limits);
+
+    // Breadth-first search that stops after k targets, given either as a predicate or as positions.
+    // Returns the nearest (carrying the statistics) and fills found with all targets reached.
+    template<typename TileContainer>
+    PathResult RunNearestSearch(const Position& start, int k, const TilePredicate* is_target,
+                                const std::vector<Position>* targets, const char* algorithm,
+                                const Map<TileContainer>& game_map, std::vector<PathResult>& found);
+
+    // Statistics helpers
+    template<typename TileContainer>
+    void FinishSearch(PathResult& result, const char* algorithm, const Position& start, const Position& goal,
+                      const Map<TileContainer>& game_map,
+                      std::chrono::steady_clock::time_point start_time) const;
+
+    template<typename TileContainer>
+    void FinishSearch(SearchStats& stats, bool path_found, const char* algorithm, const Position& start,
+                      const Position& goal, const Map<TileContainer>& game_map,
+                      std::chrono::steady_clock::time_point start_time) const;
+
     // Heuristic functions
     float CalculateHeuristic(const Position& from, const Position& to) const;
-    float CalculateDistance(const Position& from, const Position& to) const;
 
     // Path reconstruction
     std::vector<Position> ReconstructPath(PathNode* goal_node) const;
 
-    // Neighbor handling
-    template<typename TileContainer>
-    std::vector<Position> GetNeighbors(const Position& pos, const Map<TileContainer>& game_map) const;
-
+    // Neighbor handling (neighbors themselves come from the movement models)
     template<typename TileContainer>
     bool IsValidMove(const Position& pos, const Map<TileContainer>& game_map) const;
 
@@ -90,11 +336,23 @@ private:
     std::string PositionToString(const Position& pos) const;
 };
 
+// ******************** OPEN SET ENTRY ********************
+
+// Costs are copied into the entry so a node can be improved without breaking the heap;
+// entries whose g_cost no longer matches their node are stale and skipped when popped
+struct OpenListEntry {
+    PathNode* node;
+    float f_cost;
+    float g_cost;
+
+    OpenListEntry(PathNode* n, float f, float g) : node(n), f_cost(f), g_cost(g) {}
+};
+
 // ******************** COMPARISON OPERATORS FOR PRIORITY QUEUE ********************
 
-struct PathNodeComparator {
-    bool operator()(const PathNode* a, const PathNode* b) const {
-        return a->f_cost > b->f_cost; // Min-heap based on f_cost
+struct OpenListEntryComparator {
+    bool operator()(const OpenListEntry& a, const OpenListEntry& b) const {
+        return a.f_cost > b.f_cost; // Min-heap based on f_cost
     }
 };
 
@@ -102,7 +360,13 @@ struct PathNodeComparator {
 
 struct PositionHash {
     std::size_t operator()(const Position& pos) const {
-        return std::hash<int>()(pos.x) ^ (std::hash<int>()(pos.y) << 1);
+        // x ^ (y << 1) sends whole diagonals of a grid to a handful of buckets, so pack both
+        // coordinates into one word and mix it (splitmix64 finalizer)
+        uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(pos.x)) << 32) |
+                       static_cast<uint32_t>(pos.y);
+        key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+        return static_cast<std::size_t>(key ^ (key >> 31));
     }
 };
 
@@ -0,0 +1,364 @@
+#include "RectangleSymmetryReduction.h"
+#include "Map.h"
+#include <iostream>
+#include <algorithm>
+#include <queue>
+#include <cstdlib>
+#include <tuple>
+
+// ******************** CONSTRUCTOR & DESTRUCTOR ********************
+
+RectangleSymmetryReduction::RectangleSymmetryReduction()
+        : width_(0), height_(0), map_identity_(nullptr), map_revision_(0), search_stamp_(0) {
+}
+
+RectangleSymmetryReduction::~RectangleSymmetryReduction() {
+    // No dynamic cleanup needed
+}
+
+// ******************** PREPROCESSING ********************
+
+template<typename TileContainer>
+void RectangleSymmetryReduction::Build(const Map<TileContainer>& game_map) {
+    width_ = game_map.GetWidth();
+    height_ = game_map.GetHeight();
+
+    std::vector<uint8_t> traversable(static_cast<size_t>(width_) * height_, 0);
+    for (int y = 0; y < height_; ++y) {
+        for (int x = 0; x < width_; ++x) {
+            traversable[GetIndex(x, y)] = game_map.GetTile(x, y).IsTraversable() ? 1 : 0;
+        }
+    }
+
+    Decompose(traversable);
+    map_identity_ = &game_map;
+    map_revision_ = game_map.GetRevision();
+}
+
+template<typename TileContainer>
+void RectangleSymmetryReduction::Synchronize(const Map<TileContainer>& game_map) {
+    if (map_identity_ != &game_map || map_revision_ != game_map.GetRevision() ||
+        width_ != game_map.GetWidth() || height_ != game_map.GetHeight()) {
+        Build(game_map);
+    }
+}
+
+void RectangleSymmetryReduction::Decompose(const std::vector<uint8_t>& traversable) {
+    rectangles_.clear();
+    rectangle_ids_.assign(traversable.size(), -1);
+
+    auto is_open = [&](int x, int y) {
+        int index = GetIndex(x, y);
+        return traversable[index] != 0 && rectangle_ids_[index] < 0;
+    };
+
+    // Greedy: every uncovered tile in scan order starts the larger of a row-first
+    // and a column-first grown rectangle
+    for (int y = 0; y < height_; ++y) {
+        for (int x = 0; x < width_; ++x) {
+            if (!is_open(x, y)) continue;
+
+            // Row first: widest run, then as many rows as fit below it
+            int row_width = 0;
+            while (x + row_width < width_ && is_open(x + row_width, y)) row_width++;
+            int row_height = 1;
+            while (y + row_height < height_) {
+                bool fits = true;
+                for (int i = 0; i < row_width && fits; ++i) {
+                    fits = is_open(x + i, y + row_height);
+                }
+                if (!fits) break;
+                row_height++;
+            }
+
+            // Column first: tallest run, then as many columns as fit beside it
+            int column_height = 0;
+            while (y + column_height < height_ && is_open(x, y + column_height)) column_height++;
+            int column_width = 1;
+            while (x + column_width < width_) {
+                bool fits = true;
+                for (int j = 0; j < column_height && fits; ++j) {
+                    fits = is_open(x + column_width, y + j);
+                }
+                if (!fits) break;
+                column_width++;
+            }
+
+            int rect_width = row_width;
+            int rect_height = row_height;
+            if (column_width * column_height > row_width * row_height) {
+                rect_width = column_width;
+                rect_height = column_height;
+            }
+
+            int id = static_cast<int>(rectangles_.size());
+            rectangles_.emplace_back(x, y, x + rect_width - 1, y + rect_height - 1);
+            for (int j = 0; j < rect_height; ++j) {
+                for (int i = 0; i < rect_width; ++i) {
+                    rectangle_ids_[GetIndex(x + i, y + j)] = id;
+                }
+            }
+        }
+    }
+}
+
+// ******************** QUERY ********************
+
+PathResult RectangleSymmetryReduction::FindPath(const Position& start, const Position& goal) {
+    PathResult result;
+    SearchStats& stats = result.stats;
+
+    if (!IsFree(start.x, start.y) || !IsFree(goal.x, goal.y)) {
+        return result;
+    }
+
+    int start_rect = rectangle_ids_[GetIndex(start.x, start.y)];
+    int goal_rect = rectangle_ids_[GetIndex(goal.x, goal.y)];
+
+    // Same rectangle: any Manhattan path is free of obstacles
+    if (start_rect == goal_rect) {
+        result.path.push_back(start);
+        AppendStraightSegments(start, goal, result.path);
+        result.total_cost = static_cast<float>(Manhattan(start, goal));
+        result.path_found = true;
+        result.nodes_explored = 1;
+        return result;
+    }
+
+    size_t cell_count = rectangle_ids_.size();
+    if (g_costs_.size() < cell_count) {
+        g_costs_.resize(cell_count);
+        parents_.resize(cell_count);
+        visit_stamps_.resize(cell_count, 0);
+        closed_stamps_.resize(cell_count, 0);
+    }
+    if (++search_stamp_ == 0) {
+        std::fill(visit_stamps_.begin(), visit_stamps_.end(), 0);
+        std::fill(closed_stamps_.begin(), closed_stamps_.end(), 0);
+        search_stamp_ = 1;
+    }
+
+    const EmptyRectangle& goal_rectangle = rectangles_[goal_rect];
+    bool goal_is_interior = !goal_rectangle.IsPerimeter(goal.x, goal.y);
+    int start_index = GetIndex(start.x, start.y);
+    int goal_index = GetIndex(goal.x, goal.y);
+
+    // f_cost, h_cost, cell index: ties on f go to the entry closer to the goal, which matters
+    // on open terrain where many perimeter tiles share the same f_cost
+    typedef std::tuple<float, float, int> QueueEntry;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> open_set;
+
+    g_costs_[start_index] = 0;
+    parents_[start_index] = -1;
+    visit_stamps_[start_index] = search_stamp_;
+    float start_h = static_cast<float>(Manhattan(start, goal));
+    open_set.push(QueueEntry(start_h, start_h, start_index));
+    stats.pushes++;
+    stats.peak_open_size = 1;
+
+    auto relax = [&](int from_index, const Position& to, int step_cost) {
+        int to_index = GetIndex(to.x, to.y);
+        float g = g_costs_[from_index] + step_cost;
+        if (visit_stamps_[to_index] == search_stamp_ && g >= g_costs_[to_index]) {
+            return;
+        }
+        if (closed_stamps_[to_index] == search_stamp_) {
+            closed_stamps_[to_index] = 0;
+            stats.reopens++;
+        }
+        visit_stamps_[to_index] = search_stamp_;
+        g_costs_[to_index] = g;
+        parents_[to_index] = from_index;
+        float h = static_cast<float>(Manhattan(to, goal));
+        open_set.push(QueueEntry(g + h, h, to_index));
+        stats.pushes++;
+        stats.peak_open_size = std::max(stats.peak_open_size, static_cast<int>(open_set.size()));
+    };
+
+    static const int kDirectionX[4] = {0, 1, 0, -1};
+    static const int kDirectionY[4] = {-1, 0, 1, 0};
+
+    bool found = false;
+    while (!open_set.empty()) {
+        QueueEntry entry = open_set.top();
+        open_set.pop();
+        stats.pops++;
+
+        int index = std::get<2>(entry);
+        if (closed_stamps_[index] == search_stamp_ ||
+            std::get<0>(entry) > g_costs_[index] + std::get<1>(entry)) {
+            stats.stale_pops++;
+            continue;
+        }
+        closed_stamps_[index] = search_stamp_;
+        result.nodes_explored++;
+        stats.peak_closed_size = result.nodes_explored;
+
+        if (index == goal_index) {
+            found = true;
+            break;
+        }
+
+        Position current(index % width_, index / width_);
+        int rect_id = rectangle_ids_[index];
+        const EmptyRectangle& rectangle = rectangles_[rect_id];
+        bool is_interior = !rectangle.IsPerimeter(current.x, current.y);
+
+        for (int direction = 0; direction < 4; ++direction) {
+            int dx = kDirectionX[direction];
+            int dy = kDirectionY[direction];
+
+            if (is_interior) {
+                // Interior start tile: project onto each side of its rectangle
+                Position side(dx > 0 ? rectangle.max_x : (dx < 0 ? rectangle.min_x : current.x),
+                              dy > 0 ? rectangle.max_y : (dy < 0 ? rectangle.min_y : current.y));
+                relax(index, side, Manhattan(current, side));
+                continue;
+            }
+
+            Position neighbor(current.x + dx, current.y + dy);
+            if (!IsFree(neighbor.x, neighbor.y)) continue;
+
+            if (rectangle_ids_[GetIndex(neighbor.x, neighbor.y)] != rect_id ||
+                rectangle.IsPerimeter(neighbor.x, neighbor.y)) {
+                relax(index, neighbor, 1);
+            } else {
+                // Macro-edge straight across the interior to the opposite side
+                Position opposite(dx > 0 ? rectangle.max_x : (dx < 0 ? rectangle.min_x : current.x),
+                                  dy > 0 ? rectangle.max_y : (dy < 0 ? rectangle.min_y : current.y));
+                relax(index, opposite, Manhattan(current, opposite));
+            }
+        }
+
+        // Interior goal tile: reachable from every perimeter tile of its rectangle
+        if (goal_is_interior && rect_id == goal_rect && !is_interior) {
+            relax(index, goal, Manhattan(current, goal));
+        }
+    }
+
+    stats.bytes_allocated = cell_count * (sizeof(float) + sizeof(int) + 2 * sizeof(unsigned int)) +
+                            stats.peak_open_size * sizeof(QueueEntry);
+
+    if (!found) {
+        return result;
+    }
+
+    // Collect the expanded tiles and fill in the straight runs between them
+    std::vector<int> chain;
+    for (int index = goal_index; index != -1; index = parents_[index]) {
+        chain.push_back(index);
+    }
+    std::reverse(chain.begin(), chain.end());
+
+    result.path.push_back(start);
+    for (size_t i = 1; i < chain.size(); ++i) {
+        Position from(chain[i - 1] % width_, chain[i - 1] / width_);
+        Position to(chain[i] % width_, chain[i] / width_);
+        AppendStraightSegments(from, to, result.path);
+    }
+    result.total_cost = g_costs_[goal_index];
+    result.path_found = true;
+    return result;
+}
+
+// ******************** DECOMPOSITION INFO ********************
+
+int RectangleSymmetryReduction::GetPerimeterTileCount() const {
+    int count = 0;
+    for (const EmptyRectangle& rectangle : rectangles_) {
+        int rect_width = rectangle.max_x - rectangle.min_x + 1;
+        int rect_height = rectangle.max_y - rectangle.min_y + 1;
+        int interior = std::max(0, rect_width - 2) * std::max(0, rect_height - 2);
+        count += rect_width * rect_height - interior;
+    }
+    return count;
+}
+
+void RectangleSymmetryReduction::PrintDecompositionInfo() const {
+    int free_tiles = 0;
+    for (int id : rectangle_ids_) {
+        if (id >= 0) free_tiles++;
+    }
+    std::cout << "RSR decomposition: " << rectangles_.size() << " rectangles, "
+              << GetPerimeterTileCount() << " of " << free_tiles << " free tiles on perimeters" << std::endl;
+}
+
+// ******************** PRIVATE HELPER METHODS ********************
+
+bool RectangleSymmetryReduction::IsFree(int x, int y) const {
+    return x >= 0 && x < width_ && y >= 0 && y < height_ && rectangle_ids_[GetIndex(x, y)] >= 0;
+}
+
+int RectangleSymmetryReduction::Manhattan(const Position& a, const Position& b) const {
+    return std::abs(a.x - b.x) + std::abs(a.y - b.y);
+}
+
+// Both tiles lie in one empty rectangle (or are direct neighbours), so an L-shaped run is free
+void RectangleSymmetryReduction::AppendStraightSegments(const Position& from, const Position& to,
+                                                        std::vector<Position>& path) const {
+    Position current = from;
+    while (current.x != to.x) {
+        current.x += (to.x > current.x) ? 1 : -1;
+        path.push_back(current);
+    }
+    while (current.y != to.y) {
+        current.y += (to.y > current.y) ? 1 : -1;
+        path.push_back(current);
+    }
+}
+
+// ******************** EXPLICIT TEMPLATE INSTANTIATIONS ********************
+
+template void RectangleSymmetryReduction::Build<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map);
+
+template void RectangleSymmetryReduction::Synchronize<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map);
+
+// Flat row-major grid (the default Map<> container)
+
+template void RectangleSymmetryReduction::Build<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map);
+
+template void RectangleSymmetryReduction::Synchronize<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map);
+
+// Morton-ordered 8x8 blocks
+
+template void RectangleSymmetryReduction::Build<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map);
+
+template void RectangleSymmetryReduction::Synchronize<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map);
+
+// Type byte plus bit planes
+
+template void RectangleSymmetryReduction::Build<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map);
+
+template void RectangleSymmetryReduction::Synchronize<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map);
+
+// Build-time 64x64 grid
+
+template void RectangleSymmetryReduction::Build<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map);
+
+template void RectangleSymmetryReduction::Synchronize<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map);
+
+// Streamed 64x64 chunks
+
+template void RectangleSymmetryReduction::Build<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map);
+
+template void RectangleSymmetryReduction::Synchronize<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map);
+
+// Memory-mapped map file
+
+template void RectangleSymmetryReduction::Build<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map);
+
+template void RectangleSymmetryReduction::Synchronize<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map);
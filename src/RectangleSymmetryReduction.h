@@ -0,0 +1,85 @@
+#ifndef RAYLIBSTARTER_RECTANGLESYMMETRYREDUCTION_H
+#define RAYLIBSTARTER_RECTANGLESYMMETRYREDUCTION_H
+
+#include "Tile.h"
+#include "Pathfinding.h"
+#include <vector>
+#include <cstdint>
+
+// Forward declaration
+template<typename TileContainer> class Map;
+
+// ******************** EMPTY RECTANGLE STRUCTURE ********************
+
+// Inclusive cell bounds of an obstacle-free rectangle
+struct EmptyRectangle {
+    int min_x;
+    int min_y;
+    int max_x;
+    int max_y;
+
+    EmptyRectangle(int x0, int y0, int x1, int y1) : min_x(x0), min_y(y0), max_x(x1), max_y(y1) {}
+
+    bool IsPerimeter(int x, int y) const {
+        return x == min_x || x == max_x || y == min_y || y == max_y;
+    }
+};
+
+// ******************** RECTANGULAR SYMMETRY REDUCTION ********************
+
+// Traversable space is split into empty rectangles. Inside an empty rectangle every
+// Manhattan-length path is equally good, so A* only expands perimeter tiles: perimeter
+// neighbours, tiles across the rectangle border, and a macro-edge straight across the
+// interior to the opposite side. Start and goal tiles inside a rectangle are linked in
+// for the query only, so the decomposition never changes per query.
+class RectangleSymmetryReduction {
+public:
+    // Constructor
+    RectangleSymmetryReduction();
+
+    // Destructor
+    ~RectangleSymmetryReduction();
+
+    // Preprocessing
+    template<typename TileContainer>
+    void Build(const Map<TileContainer>& game_map);
+
+    // Rebuilds the decomposition if the map changed since the last build
+    template<typename TileContainer>
+    void Synchronize(const Map<TileContainer>& game_map);
+
+    // Query (the decomposition must be synchronized with the map)
+    PathResult FindPath(const Position& start, const Position& goal);
+
+    // Decomposition info
+    int GetRectangleCount() const { return static_cast<int>(rectangles_.size()); }
+    int GetPerimeterTileCount() const;
+    void PrintDecompositionInfo() const;
+
+private:
+    // Map snapshot
+    int width_;
+    int height_;
+    const void* map_identity_;
+    unsigned long long map_revision_;
+
+    // Decomposition
+    std::vector<EmptyRectangle> rectangles_;
+    std::vector<int> rectangle_ids_;       // Per cell, -1 for blocked tiles
+
+    // Query workspace (stamped, so it is not cleared between queries)
+    std::vector<float> g_costs_;
+    std::vector<int> parents_;
+    std::vector<unsigned int> visit_stamps_;
+    std::vector<unsigned int> closed_stamps_;
+    unsigned int search_stamp_;
+
+    // Helpers
+    bool IsFree(int x, int y) const;
+    int GetIndex(int x, int y) const { return y * width_ + x; }
+    int Manhattan(const Position& a, const Position& b) const;
+    void Decompose(const std::vector<uint8_t>& traversable);
+    void AppendStraightSegments(const Position& from, const Position& to, std::vector<Position>& path) const;
+};
+
+#endif //RAYLIBSTARTER_RECTANGLESYMMETRYREDUCTION_H
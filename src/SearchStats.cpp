@@ -0,0 +1,154 @@
+#include "SearchStats.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+// ******************** STATIC MEMBER DEFINITIONS ********************
+
+std::map<std::string, SearchStatsAggregator::AlgorithmSummary> SearchStatsAggregator::summaries_;
+std::mutex SearchStatsAggregator::mutex_;
+std::atomic<bool> SearchStatsAggregator::enabled_(true);
+std::atomic<long long> SearchStatsAggregator::latency_budget_ns_(1000000); // 1 ms per query by default
+
+// ******************** ALGORITHM SUMMARY ********************
+
+SearchStatsAggregator::AlgorithmSummary::AlgorithmSummary()
+        : query_count(0), over_budget_count(0), total_wall_time_ns(0), max_wall_time_ns(0),
+          total_pops(0), max_peak_open_size(0), max_bytes_allocated(0), next_slow_query(0) {
+    std::fill(latency_histogram, latency_histogram + kHistogramBuckets, 0);
+    std::fill(expansion_histogram, expansion_histogram + kHistogramBuckets, 0);
+}
+
+// ******************** RECORDING ********************
+
+void SearchStatsAggregator::Record(const std::string& algorithm, const SearchStats& stats, const SearchQuery& query) {
+    if (!enabled_) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    AlgorithmSummary& summary = summaries_[algorithm];
+
+    summary.query_count++;
+    summary.total_wall_time_ns += stats.wall_time_ns;
+    summary.max_wall_time_ns = std::max(summary.max_wall_time_ns, stats.wall_time_ns);
+    summary.total_pops += stats.pops;
+    summary.max_peak_open_size = std::max(summary.max_peak_open_size, stats.peak_open_size);
+    summary.max_bytes_allocated = std::max(summary.max_bytes_allocated, stats.bytes_allocated);
+    summary.latency_histogram[GetHistogramBucket(stats.wall_time_ns)]++;
+    summary.expansion_histogram[GetHistogramBucket(stats.pops)]++;
+
+    // Remember the most recent queries that blew the latency budget
+    if (stats.wall_time_ns > latency_budget_ns_) {
+        summary.over_budget_count++;
+
+        SlowQuery slow_query;
+        slow_query.query = query;
+        slow_query.stats = stats;
+
+        if (static_cast<int>(summary.slow_queries.size()) < kMaxSlowQueries) {
+            summary.slow_queries.push_back(slow_query);
+        } else {
+            summary.slow_queries[summary.next_slow_query] = slow_query;
+        }
+        summary.next_slow_query = (summary.next_slow_query + 1) % kMaxSlowQueries;
+    }
+}
+
+void SearchStatsAggregator::Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    summaries_.clear();
+}
+
+// ******************** CONFIGURATION ********************
+
+void SearchStatsAggregator::SetEnabled(bool enabled) {
+    enabled_ = enabled;
+}
+
+bool SearchStatsAggregator::IsEnabled() {
+    return enabled_;
+}
+
+void SearchStatsAggregator::SetLatencyBudgetNs(long long budget_ns) {
+    latency_budget_ns_ = budget_ns;
+}
+
+long long SearchStatsAggregator::GetLatencyBudgetNs() {
+    return latency_budget_ns_;
+}
+
+// ******************** REPORTING ********************
+
+std::map<std::string, SearchStatsAggregator::AlgorithmSummary> SearchStatsAggregator::GetSummaries() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return summaries_;
+}
+
+void SearchStatsAggregator::PrintReport() {
+    std::map<std::string, AlgorithmSummary> summaries = GetSummaries();
+
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    std::cout << "           SEARCH STATISTICS REPORT" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+    std::cout << "Latency budget: " << latency_budget_ns_.load() << " ns" << std::endl;
+
+    if (summaries.empty()) {
+        std::cout << "No searches recorded yet." << std::endl;
+        std::cout << std::string(60, '=') << std::endl;
+        return;
+    }
+
+    for (const auto& pair : summaries) {
+        const AlgorithmSummary& summary = pair.second;
+        long long average_ns = summary.total_wall_time_ns / std::max(1LL, summary.query_count);
+
+        std::cout << "\n>>> " << pair.first << " <<<" << std::endl;
+        std::cout << "Queries: " << summary.query_count
+                  << " | Over budget: " << summary.over_budget_count << std::endl;
+        std::cout << "Avg time: " << average_ns << " ns | Max time: " << summary.max_wall_time_ns << " ns" << std::endl;
+        std::cout << "Avg pops: " << (summary.total_pops / std::max(1LL, summary.query_count))
+                  << " | Peak open set: " << summary.max_peak_open_size
+                  << " | Peak bytes: " << summary.max_bytes_allocated << std::endl;
+
+        std::cout << "Latency histogram (ns):" << std::endl;
+        for (int bucket = 0; bucket < kHistogramBuckets; ++bucket) {
+            if (summary.latency_histogram[bucket] == 0) continue;
+            std::cout << "  [" << std::setw(12) << (1LL << bucket) << ", "
+                      << std::setw(12) << (1LL << (bucket + 1)) << ") "
+                      << std::setw(8) << summary.latency_histogram[bucket] << std::endl;
+        }
+
+        std::cout << "Expansion histogram (pops):" << std::endl;
+        for (int bucket = 0; bucket < kHistogramBuckets; ++bucket) {
+            if (summary.expansion_histogram[bucket] == 0) continue;
+            std::cout << "  [" << std::setw(12) << (1LL << bucket) << ", "
+                      << std::setw(12) << (1LL << (bucket + 1)) << ") "
+                      << std::setw(8) << summary.expansion_histogram[bucket] << std::endl;
+        }
+
+        if (!summary.slow_queries.empty()) {
+            std::cout << "Recent over-budget queries:" << std::endl;
+            for (const SlowQuery& slow : summary.slow_queries) {
+                std::cout << "  " << slow.query.map_width << "x" << slow.query.map_height << " map, ("
+                          << slow.query.start.x << "," << slow.query.start.y << ") -> ("
+                          << slow.query.goal.x << "," << slow.query.goal.y << "): "
+                          << slow.stats.wall_time_ns << " ns, "
+                          << slow.stats.pops << " pops" << std::endl;
+            }
+        }
+    }
+
+    std::cout << std::string(60, '=') << std::endl;
+}
+
+// ******************** UTILITY ********************
+
+int SearchStatsAggregator::GetHistogramBucket(long long value) {
+    int bucket = 0;
+    while (value > 1 && bucket < kHistogramBuckets - 1) {
+        value >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
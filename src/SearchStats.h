@@ -0,0 +1,97 @@
+#ifndef RAYLIBSTARTER_SEARCHSTATS_H
+#define RAYLIBSTARTER_SEARCHSTATS_H
+
+#include "Tile.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <cstddef>
+
+// ******************** SEARCH STATISTICS STRUCTURE ********************
+
+// Filled in by every search; plain counters so it can stay on in production
+struct SearchStats {
+    long long wall_time_ns;      // Time spent inside the search call
+    int pushes;                  // Entries pushed onto the open set
+    int pops;                    // Entries popped from the open set (including stale ones)
+    int stale_pops;              // Popped entries that were outdated by a cheaper push
+    int reopens;                 // Closed nodes that were reopened with a better cost
+    int peak_open_size;          // Largest open set size during the search
+    int peak_closed_size;        // Largest closed set size during the search
+    std::size_t bytes_allocated; // Memory held by the search containers at their peak
+
+    SearchStats()
+            : wall_time_ns(0), pushes(0), pops(0), stale_pops(0), reopens(0),
+              peak_open_size(0), peak_closed_size(0), bytes_allocated(0) {}
+};
+
+// ******************** SEARCH QUERY DESCRIPTION ********************
+
+struct SearchQuery {
+    Position start;
+    Position goal;
+    int map_width;
+    int map_height;
+
+    SearchQuery() : map_width(0), map_height(0) {}
+    SearchQuery(const Position& s, const Position& g, int width, int height)
+            : start(s), goal(g), map_width(width), map_height(height) {}
+};
+
+// ******************** GLOBAL STATISTICS AGGREGATOR ********************
+
+class SearchStatsAggregator {
+public:
+    // Number of power-of-two latency buckets (1ns .. ~9 minutes)
+    static const int kHistogramBuckets = 40;
+    // Number of over-budget queries remembered per algorithm
+    static const int kMaxSlowQueries = 16;
+
+    struct SlowQuery {
+        SearchQuery query;
+        SearchStats stats;
+    };
+
+    struct AlgorithmSummary {
+        long long query_count;
+        long long over_budget_count;
+        long long total_wall_time_ns;
+        long long max_wall_time_ns;
+        long long total_pops;
+        int max_peak_open_size;
+        std::size_t max_bytes_allocated;
+        long long latency_histogram[kHistogramBuckets];   // Bucket i: wall time in [2^i, 2^(i+1)) ns
+        long long expansion_histogram[kHistogramBuckets]; // Bucket i: pops in [2^i, 2^(i+1))
+        std::vector<SlowQuery> slow_queries;              // Ring buffer of over-budget queries
+        int next_slow_query;
+
+        AlgorithmSummary();
+    };
+
+    // Recording
+    static void Record(const std::string& algorithm, const SearchStats& stats, const SearchQuery& query);
+    static void Reset();
+
+    // Configuration
+    static void SetEnabled(bool enabled);
+    static bool IsEnabled();
+    static void SetLatencyBudgetNs(long long budget_ns);
+    static long long GetLatencyBudgetNs();
+
+    // Reporting
+    static std::map<std::string, AlgorithmSummary> GetSummaries();
+    static void PrintReport();
+
+    // Utility
+    static int GetHistogramBucket(long long value);
+
+private:
+    static std::map<std::string, AlgorithmSummary> summaries_;
+    static std::mutex mutex_;
+    static std::atomic<bool> enabled_;              // Read by Record before taking mutex_
+    static std::atomic<long long> latency_budget_ns_;
+};
+
+#endif //RAYLIBSTARTER_SEARCHSTATS_H
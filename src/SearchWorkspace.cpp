@@ -0,0 +1,109 @@
+#include "SearchWorkspace.h"
+#include <algorithm>
+
+// ******************** CONSTRUCTOR & DESTRUCTOR ********************
+
+SearchWorkspace::SearchWorkspace() : width_(0), height_(0), sparse_(false), stamp_(0) {
+}
+
+SearchWorkspace::~SearchWorkspace() {
+    // No dynamic cleanup needed
+}
+
+// ******************** SEARCH STATE ********************
+
+void SearchWorkspace::BeginSearch(int width, int height, bool sparse) {
+    width_ = width;
+    height_ = height;
+    sparse_ = sparse;
+    frontier_.clear();
+
+    if (sparse) {
+        sparse_tiles_.clear();
+        return;
+    }
+
+    size_t tile_count = static_cast<size_t>(width) * height;
+    if (visit_stamps_.size() < tile_count) {
+        visit_stamps_.resize(tile_count, 0);
+        target_stamps_.resize(tile_count, 0);
+        distances_.resize(tile_count);
+        parents_.resize(tile_count);
+    }
+
+    // Stamps are compared by value, so a wrap-around needs one real clear
+    if (++stamp_ == 0) {
+        std::fill(visit_stamps_.begin(), visit_stamps_.end(), 0);
+        std::fill(target_stamps_.begin(), target_stamps_.end(), 0);
+        stamp_ = 1;
+    }
+}
+
+bool SearchWorkspace::IsVisited(int64_t index) const {
+    if (sparse_) {
+        auto found = sparse_tiles_.find(index);
+        return found != sparse_tiles_.end() && found->second.visited;
+    }
+    return visit_stamps_[index] == stamp_;
+}
+
+void SearchWorkspace::Visit(int64_t index, int distance, int64_t parent) {
+    if (sparse_) {
+        SparseTile& tile = sparse_tiles_[index];
+        tile.visited = true;
+        tile.distance = distance;
+        tile.parent = parent;
+        return;
+    }
+    visit_stamps_[index] = stamp_;
+    distances_[index] = distance;
+    parents_[index] = parent;
+}
+
+int SearchWorkspace::GetDistance(int64_t index) const {
+    return sparse_ ? sparse_tiles_.at(index).distance : distances_[index];
+}
+
+int64_t SearchWorkspace::GetParent(int64_t index) const {
+    return sparse_ ? sparse_tiles_.at(index).parent : parents_[index];
+}
+
+void SearchWorkspace::MarkTarget(int64_t index) {
+    if (sparse_) {
+        sparse_tiles_[index].target = true;
+        return;
+    }
+    target_stamps_[index] = stamp_;
+}
+
+bool SearchWorkspace::IsTarget(int64_t index) const {
+    if (sparse_) {
+        auto found = sparse_tiles_.find(index);
+        return found != sparse_tiles_.end() && found->second.target;
+    }
+    return target_stamps_[index] == stamp_;
+}
+
+// ******************** PATH RECONSTRUCTION ********************
+
+std::vector<Position> SearchWorkspace::ReconstructPath(int64_t index) const {
+    std::vector<Position> path;
+    if (index < 0 || !IsVisited(index)) {
+        return path;
+    }
+
+    for (int64_t current = index; current != -1; current = GetParent(current)) {
+        path.push_back(GetPosition(current));
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+std::size_t SearchWorkspace::GetBytesAllocated() const {
+    // Hash nodes: key, value and the next pointer, plus one bucket pointer each
+    std::size_t sparse_bytes = sparse_tiles_.size() * (sizeof(std::pair<const int64_t, SparseTile>) + sizeof(void*)) +
+                               sparse_tiles_.bucket_count() * sizeof(void*);
+    return (visit_stamps_.capacity() + target_stamps_.capacity()) * sizeof(unsigned int) +
+           distances_.capacity() * sizeof(int) +
+           (parents_.capacity() + frontier_.capacity()) * sizeof(int64_t) + sparse_bytes;
+}
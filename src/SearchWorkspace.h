@@ -0,0 +1,78 @@
+#ifndef RAYLIBSTARTER_SEARCHWORKSPACE_H
+#define RAYLIBSTARTER_SEARCHWORKSPACE_H
+
+#include "Tile.h"
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+
+// ******************** SEARCH WORKSPACE ********************
+
+// Per-tile state for repeated searches on the same map. Dense mode keeps arrays the size of the
+// map whose visit marks are stamped, so starting a new search is O(1) instead of clearing every
+// array. Sparse mode, for streamed maps too large for per-tile arrays, keeps only the tiles the
+// search touches in a hash map. Tiles are 64-bit indices (y * width + x) in both modes.
+class SearchWorkspace {
+public:
+    // Constructor
+    SearchWorkspace();
+
+    // Destructor
+    ~SearchWorkspace();
+
+    // Starts a new search, growing the dense arrays if the map is larger than before
+    void BeginSearch(int width, int height, bool sparse = false);
+
+    // Tile state for the current search
+    bool IsVisited(int64_t index) const;
+    void Visit(int64_t index, int distance, int64_t parent);
+    int GetDistance(int64_t index) const;
+    int64_t GetParent(int64_t index) const;
+
+    // Target marks for the current search, cleared by BeginSearch like the visit marks
+    void MarkTarget(int64_t index);
+    bool IsTarget(int64_t index) const;
+
+    // Frontier buffer, cleared by BeginSearch
+    std::vector<int64_t>& GetFrontier() { return frontier_; }
+
+    // Index helpers
+    int64_t GetIndex(const Position& pos) const { return static_cast<int64_t>(pos.y) * width_ + pos.x; }
+    int64_t GetIndex(int x, int y) const { return static_cast<int64_t>(y) * width_ + x; }
+    Position GetPosition(int64_t index) const {
+        return Position(static_cast<int>(index % width_), static_cast<int>(index / width_));
+    }
+    int GetWidth() const { return width_; }
+    int GetHeight() const { return height_; }
+    bool IsSparse() const { return sparse_; }
+
+    // Path from the search start to a visited tile
+    std::vector<Position> ReconstructPath(int64_t index) const;
+
+    std::size_t GetBytesAllocated() const;
+
+private:
+    // Sparse-mode state of one touched tile
+    struct SparseTile {
+        bool visited;
+        bool target;
+        int distance;
+        int64_t parent;
+
+        SparseTile() : visited(false), target(false), distance(0), parent(-1) {}
+    };
+
+    int width_;
+    int height_;
+    bool sparse_;
+    unsigned int stamp_;
+    std::vector<unsigned int> visit_stamps_;
+    std::vector<unsigned int> target_stamps_;
+    std::vector<int> distances_;
+    std::vector<int64_t> parents_;
+    std::unordered_map<int64_t, SparseTile> sparse_tiles_;
+    std::vector<int64_t> frontier_;
+};
+
+#endif //RAYLIBSTARTER_SEARCHWORKSPACE_H
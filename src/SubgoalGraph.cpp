@@ -0,0 +1,551 @@
+#include "SubgoalGraph.h"
+#include "Map.h"
+#include <iostream>
+#include <algorithm>
+#include <queue>
+#include <cstdlib>
+
+// ******************** CONSTRUCTOR & DESTRUCTOR ********************
+
+SubgoalGraph::SubgoalGraph()
+        : width_(0), height_(0), map_identity_(nullptr), map_revision_(0),
+          subgoal_count_(0), search_stamp_(0) {
+}
+
+SubgoalGraph::~SubgoalGraph() {
+    // No dynamic cleanup needed
+}
+
+// ******************** PREPROCESSING ********************
+
+template<typename TileContainer>
+void SubgoalGraph::Build(const Map<TileContainer>& game_map) {
+    width_ = game_map.GetWidth();
+    height_ = game_map.GetHeight();
+    traversable_.assign(static_cast<size_t>(width_) * height_, 0);
+
+    for (int y = 0; y < height_; ++y) {
+        for (int x = 0; x < width_; ++x) {
+            traversable_[y * width_ + x] = game_map.GetTile(x, y).IsTraversable() ? 1 : 0;
+        }
+    }
+
+    map_identity_ = &game_map;
+    map_revision_ = game_map.GetRevision();
+    RebuildFromSnapshot();
+}
+
+template<typename TileContainer>
+void SubgoalGraph::Synchronize(const Map<TileContainer>& game_map) {
+    if (map_identity_ != &game_map || width_ != game_map.GetWidth() || height_ != game_map.GetHeight()) {
+        Build(game_map);
+        return;
+    }
+
+    if (map_revision_ == game_map.GetRevision()) {
+        return;
+    }
+
+    std::vector<Position> changed_tiles;
+    if (!game_map.GetTileChangesSince(map_revision_, changed_tiles)) {
+        Build(game_map);
+        return;
+    }
+
+    for (const Position& pos : changed_tiles) {
+        UpdateTile(game_map, pos);
+    }
+    map_revision_ = game_map.GetRevision();
+}
+
+template<typename TileContainer>
+void SubgoalGraph::UpdateTile(const Map<TileContainer>& game_map, const Position& pos) {
+    if (!IsInside(pos.x, pos.y)) {
+        return;
+    }
+    ApplyTileChange(pos, game_map.GetTile(pos).IsTraversable());
+}
+
+void SubgoalGraph::RebuildFromSnapshot() {
+    subgoal_slot_.assign(traversable_.size(), -1);
+    slot_positions_.clear();
+    edges_.clear();
+    free_slots_.clear();
+    subgoal_count_ = 0;
+
+    for (int y = 0; y < height_; ++y) {
+        for (int x = 0; x < width_; ++x) {
+            if (IsCorner(x, y)) {
+                AddSubgoal(Position(x, y));
+            }
+        }
+    }
+
+    for (int slot = 0; slot < static_cast<int>(slot_positions_.size()); ++slot) {
+        ConnectSubgoal(slot);
+    }
+}
+
+void SubgoalGraph::ApplyTileChange(const Position& pos, bool traversable) {
+    uint8_t& cell = traversable_[pos.y * width_ + pos.x];
+    if ((cell != 0) == traversable) {
+        return; // Tile type changed but traversability did not (e.g. a chest was opened)
+    }
+    cell = traversable ? 1 : 0;
+
+    std::vector<int> affected;
+    std::vector<int> added;
+
+    // Corner status only depends on the 3x3 neighbourhood
+    for (int dy = -1; dy <= 1; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) {
+            int x = pos.x + dx;
+            int y = pos.y + dy;
+            if (!IsInside(x, y)) continue;
+
+            int slot = subgoal_slot_[y * width_ + x];
+            bool is_corner = IsCorner(x, y);
+            if (slot >= 0 && !is_corner) {
+                // Pairs that used to be separated by this subgoal may now be directly connected
+                affected.insert(affected.end(), edges_[slot].begin(), edges_[slot].end());
+                RemoveSubgoal(slot);
+            } else if (slot < 0 && is_corner) {
+                added.push_back(AddSubgoal(Position(x, y)));
+            }
+        }
+    }
+
+    // Subgoals whose monotone paths can run through the changed tile or a new subgoal
+    std::vector<int> reached;
+    CollectDirectReachable(pos, reached);
+    affected.insert(affected.end(), reached.begin(), reached.end());
+    for (int slot : added) {
+        CollectDirectReachable(slot_positions_[slot], reached);
+        affected.insert(affected.end(), reached.begin(), reached.end());
+        affected.push_back(slot);
+    }
+
+    std::sort(affected.begin(), affected.end());
+    affected.erase(std::unique(affected.begin(), affected.end()), affected.end());
+    affected.erase(std::remove_if(affected.begin(), affected.end(),
+                                  [this](int slot) { return slot_positions_[slot].x < 0; }),
+                   affected.end());
+
+    for (int slot : affected) {
+        ClearEdges(slot);
+    }
+    for (int slot : affected) {
+        ConnectSubgoal(slot);
+    }
+}
+
+// ******************** GRAPH MAINTENANCE ********************
+
+int SubgoalGraph::AddSubgoal(const Position& pos) {
+    int slot;
+    if (!free_slots_.empty()) {
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+        slot_positions_[slot] = pos;
+    } else {
+        slot = static_cast<int>(slot_positions_.size());
+        slot_positions_.push_back(pos);
+        edges_.emplace_back();
+    }
+
+    subgoal_slot_[pos.y * width_ + pos.x] = slot;
+    subgoal_count_++;
+    return slot;
+}
+
+void SubgoalGraph::RemoveSubgoal(int slot) {
+    ClearEdges(slot);
+
+    const Position& pos = slot_positions_[slot];
+    subgoal_slot_[pos.y * width_ + pos.x] = -1;
+    slot_positions_[slot] = Position(-1, -1);
+    free_slots_.push_back(slot);
+    subgoal_count_--;
+}
+
+void SubgoalGraph::AddEdge(int a, int b) {
+    if (a == b || std::find(edges_[a].begin(), edges_[a].end(), b) != edges_[a].end()) {
+        return;
+    }
+    edges_[a].push_back(b);
+    edges_[b].push_back(a);
+}
+
+void SubgoalGraph::ClearEdges(int slot) {
+    for (int neighbor : edges_[slot]) {
+        std::vector<int>& back_edges = edges_[neighbor];
+        back_edges.erase(std::remove(back_edges.begin(), back_edges.end(), slot), back_edges.end());
+    }
+    edges_[slot].clear();
+}
+
+void SubgoalGraph::ConnectSubgoal(int slot) {
+    std::vector<int> reached;
+    CollectDirectReachable(slot_positions_[slot], reached);
+    for (int other : reached) {
+        AddEdge(slot, other);
+    }
+}
+
+// ******************** REACHABILITY ********************
+
+void SubgoalGraph::CollectDirectReachable(const Position& source, std::vector<int>& reached_slots) {
+    reached_slots.clear();
+
+    size_t extent = static_cast<size_t>(std::max(width_, height_));
+    if (previous_row_.size() < extent) {
+        previous_row_.resize(extent);
+        current_row_.resize(extent);
+    }
+
+    // Sweep each quadrant row by row; a cell is reached from its left or upper neighbour
+    // (relative to the quadrant), and sweeps do not continue through other subgoals
+    for (int qy = -1; qy <= 1; qy += 2) {
+        for (int qx = -1; qx <= 1; qx += 2) {
+            int previous_max = -1;
+
+            for (int j = 0; ; ++j) {
+                int y = source.y + j * qy;
+                if (y < 0 || y >= height_) break;
+
+                int current_max = -1;
+                for (int i = 0; ; ++i) {
+                    int x = source.x + i * qx;
+                    if (x < 0 || x >= width_) break;
+
+                    bool is_source = (i == 0 && j == 0);
+                    bool from_left = i > 0 && current_row_[i - 1] != 0;
+                    bool from_above = j > 0 && i <= previous_max && previous_row_[i] != 0;
+                    if (!is_source && !from_left && i > previous_max) break;
+
+                    bool passable = is_source || ((from_left || from_above) && traversable_[y * width_ + x] != 0);
+                    if (passable && !is_source) {
+                        int slot = subgoal_slot_[y * width_ + x];
+                        if (slot >= 0) {
+                            reached_slots.push_back(slot);
+                            passable = false;
+                        }
+                    }
+
+                    current_row_[i] = passable ? 1 : 0;
+                    if (passable) current_max = i;
+                }
+
+                if (current_max < 0) break;
+                std::swap(previous_row_, current_row_);
+                previous_max = current_max;
+            }
+        }
+    }
+
+    // Cells on the axes are visited by two quadrants
+    std::sort(reached_slots.begin(), reached_slots.end());
+    reached_slots.erase(std::unique(reached_slots.begin(), reached_slots.end()), reached_slots.end());
+}
+
+bool SubgoalGraph::FindMonotonePath(const Position& from, const Position& to, std::vector<Position>* steps) const {
+    int step_x = (to.x >= from.x) ? 1 : -1;
+    int step_y = (to.y >= from.y) ? 1 : -1;
+    int box_width = std::abs(to.x - from.x) + 1;
+    int box_height = std::abs(to.y - from.y) + 1;
+
+    std::vector<uint8_t> reached(static_cast<size_t>(box_width) * box_height, 0);
+    for (int j = 0; j < box_height; ++j) {
+        for (int i = 0; i < box_width; ++i) {
+            if (i == 0 && j == 0) {
+                reached[0] = 1;
+                continue;
+            }
+            if (!IsFree(from.x + i * step_x, from.y + j * step_y)) continue;
+
+            bool from_left = i > 0 && reached[j * box_width + i - 1] != 0;
+            bool from_above = j > 0 && reached[(j - 1) * box_width + i] != 0;
+            reached[j * box_width + i] = (from_left || from_above) ? 1 : 0;
+        }
+    }
+
+    if (reached[reached.size() - 1] == 0) {
+        return false;
+    }
+
+    if (steps) {
+        // Walk back from the target, appending in reverse
+        size_t first_step = steps->size();
+        int i = box_width - 1;
+        int j = box_height - 1;
+        while (i > 0 || j > 0) {
+            steps->push_back(Position(from.x + i * step_x, from.y + j * step_y));
+            if (i > 0 && reached[j * box_width + i - 1] != 0) {
+                i--;
+            } else {
+                j--;
+            }
+        }
+        std::reverse(steps->begin() + first_step, steps->end());
+    }
+    return true;
+}
+
+// ******************** QUERY ********************
+
+PathResult SubgoalGraph::FindPath(const Position& start, const Position& goal) {
+    PathResult result;
+    SearchStats& stats = result.stats;
+
+    if (!IsFree(start.x, start.y) || !IsFree(goal.x, goal.y)) {
+        return result;
+    }
+
+    // Goal h-reachable from start: no graph search needed
+    std::vector<Position> direct_path(1, start);
+    if (FindMonotonePath(start, goal, &direct_path)) {
+        result.path = direct_path;
+        result.total_cost = static_cast<float>(Manhattan(start, goal));
+        result.path_found = true;
+        result.nodes_explored = 1;
+        return result;
+    }
+
+    // Node ids: subgoal slots, then a temporary start and goal node
+    int slot_count = static_cast<int>(slot_positions_.size());
+    int start_node = subgoal_slot_[start.y * width_ + start.x];
+    int goal_node = subgoal_slot_[goal.y * width_ + goal.x];
+    if (start_node < 0) start_node = slot_count;
+    if (goal_node < 0) goal_node = slot_count + 1;
+
+    size_t node_count = static_cast<size_t>(slot_count) + 2;
+    if (g_costs_.size() < node_count) {
+        g_costs_.resize(node_count);
+        parents_.resize(node_count);
+        visit_stamps_.resize(node_count, 0);
+        closed_stamps_.resize(node_count, 0);
+        goal_link_stamps_.resize(node_count, 0);
+    }
+    if (++search_stamp_ == 0) {
+        std::fill(visit_stamps_.begin(), visit_stamps_.end(), 0);
+        std::fill(closed_stamps_.begin(), closed_stamps_.end(), 0);
+        std::fill(goal_link_stamps_.begin(), goal_link_stamps_.end(), 0);
+        search_stamp_ = 1;
+    }
+
+    auto node_position = [&](int node) -> Position {
+        if (node < slot_count) return slot_positions_[node];
+        return (node == slot_count) ? start : goal;
+    };
+
+    // Connect the temporary nodes to the graph
+    std::vector<int> start_links;
+    if (start_node == slot_count) {
+        CollectDirectReachable(start, start_links);
+    }
+    if (goal_node == slot_count + 1) {
+        std::vector<int> goal_links;
+        CollectDirectReachable(goal, goal_links);
+        for (int slot : goal_links) {
+            goal_link_stamps_[slot] = search_stamp_;
+        }
+    }
+
+    typedef std::pair<float, int> QueueEntry; // f_cost, node
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> open_set;
+
+    g_costs_[start_node] = 0;
+    parents_[start_node] = -1;
+    visit_stamps_[start_node] = search_stamp_;
+    open_set.push(QueueEntry(static_cast<float>(Manhattan(start, goal)), start_node));
+    stats.pushes++;
+    stats.peak_open_size = 1;
+
+    auto relax = [&](int from, int to) {
+        float g = g_costs_[from] + Manhattan(node_position(from), node_position(to));
+        if (visit_stamps_[to] == search_stamp_ && g >= g_costs_[to]) {
+            return;
+        }
+        if (closed_stamps_[to] == search_stamp_) {
+            closed_stamps_[to] = 0;
+            stats.reopens++;
+        }
+        visit_stamps_[to] = search_stamp_;
+        g_costs_[to] = g;
+        parents_[to] = from;
+        open_set.push(QueueEntry(g + Manhattan(node_position(to), goal), to));
+        stats.pushes++;
+        stats.peak_open_size = std::max(stats.peak_open_size, static_cast<int>(open_set.size()));
+    };
+
+    bool found = false;
+    while (!open_set.empty()) {
+        QueueEntry entry = open_set.top();
+        open_set.pop();
+        stats.pops++;
+
+        int node = entry.second;
+        if (closed_stamps_[node] == search_stamp_ ||
+            entry.first > g_costs_[node] + Manhattan(node_position(node), goal)) {
+            stats.stale_pops++;
+            continue;
+        }
+        closed_stamps_[node] = search_stamp_;
+        result.nodes_explored++;
+        stats.peak_closed_size = result.nodes_explored;
+
+        if (node == goal_node) {
+            found = true;
+            break;
+        }
+
+        const std::vector<int>& neighbors = (node == slot_count) ? start_links : edges_[node];
+        for (int neighbor : neighbors) {
+            relax(node, neighbor);
+        }
+        if (node < slot_count && goal_link_stamps_[node] == search_stamp_) {
+            relax(node, goal_node);
+        }
+    }
+
+    stats.bytes_allocated = node_count * (sizeof(float) + sizeof(int) + 3 * sizeof(unsigned int)) +
+                            stats.peak_open_size * sizeof(QueueEntry);
+
+    if (!found) {
+        return result;
+    }
+
+    // Collect the subgoal sequence and refine each edge into single steps
+    std::vector<int> nodes;
+    for (int node = goal_node; node != -1; node = parents_[node]) {
+        nodes.push_back(node);
+    }
+    std::reverse(nodes.begin(), nodes.end());
+
+    result.path.push_back(start);
+    for (size_t i = 1; i < nodes.size(); ++i) {
+        FindMonotonePath(node_position(nodes[i - 1]), node_position(nodes[i]), &result.path);
+    }
+    result.total_cost = g_costs_[goal_node];
+    result.path_found = true;
+    return result;
+}
+
+// ******************** GRAPH INFO ********************
+
+int SubgoalGraph::GetEdgeCount() const {
+    size_t total = 0;
+    for (const std::vector<int>& neighbors : edges_) {
+        total += neighbors.size();
+    }
+    return static_cast<int>(total / 2);
+}
+
+bool SubgoalGraph::IsSubgoal(const Position& pos) const {
+    return IsInside(pos.x, pos.y) && subgoal_slot_[pos.y * width_ + pos.x] >= 0;
+}
+
+void SubgoalGraph::PrintGraphInfo() const {
+    std::cout << "Subgoal graph: " << subgoal_count_ << " subgoals, " << GetEdgeCount()
+              << " edges on a " << width_ << "x" << height_ << " map" << std::endl;
+}
+
+// ******************** PRIVATE HELPER METHODS ********************
+
+bool SubgoalGraph::IsCorner(int x, int y) const {
+    if (!IsFree(x, y)) {
+        return false;
+    }
+
+    // Convex corner: a blocked diagonal whose two adjacent cardinal tiles are free
+    for (int dy = -1; dy <= 1; dy += 2) {
+        for (int dx = -1; dx <= 1; dx += 2) {
+            if (IsInside(x + dx, y + dy) && !IsFree(x + dx, y + dy) &&
+                IsFree(x + dx, y) && IsFree(x, y + dy)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+int SubgoalGraph::Manhattan(const Position& a, const Position& b) const {
+    return std::abs(a.x - b.x) + std::abs(a.y - b.y);
+}
+
+// ******************** EXPLICIT TEMPLATE INSTANTIATIONS ********************
+
+template void SubgoalGraph::Build<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map);
+
+template void SubgoalGraph::Synchronize<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map);
+
+template void SubgoalGraph::UpdateTile<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map, const Position& pos);
+
+// Flat row-major grid (the default Map<> container)
+
+template void SubgoalGraph::Build<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map);
+
+template void SubgoalGraph::Synchronize<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map);
+
+template void SubgoalGraph::UpdateTile<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map, const Position& pos);
+
+// Morton-ordered 8x8 blocks
+
+template void SubgoalGraph::Build<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map);
+
+template void SubgoalGraph::Synchronize<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map);
+
+template void SubgoalGraph::UpdateTile<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map, const Position& pos);
+
+// Type byte plus bit planes
+
+template void SubgoalGraph::Build<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map);
+
+template void SubgoalGraph::Synchronize<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map);
+
+template void SubgoalGraph::UpdateTile<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map, const Position& pos);
+
+// Build-time 64x64 grid
+
+template void SubgoalGraph::Build<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map);
+
+template void SubgoalGraph::Synchronize<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map);
+
+template void SubgoalGraph::UpdateTile<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map, const Position& pos);
+
+// Streamed 64x64 chunks
+
+template void SubgoalGraph::Build<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map);
+
+template void SubgoalGraph::Synchronize<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map);
+
+template void SubgoalGraph::UpdateTile<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map, const Position& pos);
+
+// Memory-mapped map file
+
+template void SubgoalGraph::Build<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map);
+
+template void SubgoalGraph::Synchronize<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map);
+
+template void SubgoalGraph::UpdateTile<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map, const Position& pos);
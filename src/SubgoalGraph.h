@@ -0,0 +1,94 @@
+#ifndef RAYLIBSTARTER_SUBGOALGRAPH_H
+#define RAYLIBSTARTER_SUBGOALGRAPH_H
+
+#include "Tile.h"
+#include "Pathfinding.h"
+#include <vector>
+#include <cstdint>
+
+// Forward declaration
+template<typename TileContainer> class Map;
+
+// ******************** SIMPLE SUBGOAL GRAPH ********************
+
+// Subgoals sit on the convex corners of blocked clusters. Two subgoals are connected when one
+// can reach the other with a Manhattan-length (monotone) path that passes no other subgoal.
+// A query connects start and goal to the graph, runs A* over the subgoals and refines every
+// edge back into single steps, which gives the same path length as A* on the full grid.
+class SubgoalGraph {
+public:
+    // Constructor
+    SubgoalGraph();
+
+    // Destructor
+    ~SubgoalGraph();
+
+    // Preprocessing
+    template<typename TileContainer>
+    void Build(const Map<TileContainer>& game_map);
+
+    // Brings the graph up to date with the map, replaying single tile changes when possible
+    template<typename TileContainer>
+    void Synchronize(const Map<TileContainer>& game_map);
+
+    // Incremental update after one tile of the map changed
+    template<typename TileContainer>
+    void UpdateTile(const Map<TileContainer>& game_map, const Position& pos);
+
+    // Query (the graph must be synchronized with the map)
+    PathResult FindPath(const Position& start, const Position& goal);
+
+    // Graph info
+    int GetSubgoalCount() const { return subgoal_count_; }
+    int GetEdgeCount() const;
+    bool IsSubgoal(const Position& pos) const;
+    void PrintGraphInfo() const;
+
+private:
+    // Map snapshot
+    int width_;
+    int height_;
+    std::vector<uint8_t> traversable_;     // Row-major traversability
+    const void* map_identity_;
+    unsigned long long map_revision_;
+
+    // Graph storage (slots of removed subgoals are reused)
+    std::vector<int> subgoal_slot_;         // Per cell, -1 if the cell is no subgoal
+    std::vector<Position> slot_positions_;
+    std::vector<std::vector<int>> edges_;
+    std::vector<int> free_slots_;
+    int subgoal_count_;
+
+    // Query workspace (stamped, so it is not cleared between queries)
+    std::vector<float> g_costs_;
+    std::vector<int> parents_;
+    std::vector<unsigned int> visit_stamps_;
+    std::vector<unsigned int> closed_stamps_;
+    std::vector<unsigned int> goal_link_stamps_;
+    unsigned int search_stamp_;
+
+    // Sweep buffers
+    std::vector<uint8_t> previous_row_;
+    std::vector<uint8_t> current_row_;
+
+    // Grid helpers
+    bool IsInside(int x, int y) const { return x >= 0 && x < width_ && y >= 0 && y < height_; }
+    bool IsFree(int x, int y) const { return IsInside(x, y) && traversable_[y * width_ + x] != 0; }
+    bool IsCorner(int x, int y) const;
+    int Manhattan(const Position& a, const Position& b) const;
+
+    // Graph maintenance
+    void RebuildFromSnapshot();
+    int AddSubgoal(const Position& pos);
+    void RemoveSubgoal(int slot);
+    void AddEdge(int a, int b);
+    void ClearEdges(int slot);
+    void ConnectSubgoal(int slot);
+    void ApplyTileChange(const Position& pos, bool traversable);
+
+    // Reachability
+    void CollectDirectReachable(const Position& source, std::vector<int>& reached_slots);
+    bool FindMonotonePath(const Position& from, const Position& to, std::vector<Position>* steps) const;
+};
+
+#endif //RAYLIBSTARTER_SUBGOALGRAPH_H
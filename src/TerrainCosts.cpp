@@ -0,0 +1,133 @@
+#include "TerrainCosts.h"
+#include "Map.h"
+#include <iostream>
+#include <algorithm>
+
+// ******************** STATIC MEMBER DEFINITIONS ********************
+
+const float TerrainCosts::kMinimumTypeCost = 0.01f;
+
+// ******************** CONSTRUCTOR & DESTRUCTOR ********************
+
+TerrainCosts::TerrainCosts()
+        : minimum_cost_(1.0f), is_uniform_(true), table_revision_(1),
+          width_(0), height_(0), map_identity_(nullptr), map_revision_(0), grid_table_revision_(0) {
+    std::fill(type_costs_, type_costs_ + kTileTypeCount, 1.0f);
+}
+
+TerrainCosts::~TerrainCosts() {
+    // No dynamic cleanup needed
+}
+
+// ******************** COST TABLE ********************
+
+void TerrainCosts::SetCost(TileType type, float cost) {
+    float& entry = type_costs_[static_cast<int>(type)];
+    cost = std::max(kMinimumTypeCost, cost);
+    if (entry == cost) {
+        return;
+    }
+
+    entry = cost;
+    table_revision_++;
+    UpdateSummary();
+}
+
+void TerrainCosts::ResetToUniform() {
+    std::fill(type_costs_, type_costs_ + kTileTypeCount, 1.0f);
+    table_revision_++;
+    UpdateSummary();
+}
+
+// Blocked types are never entered, so they affect neither uniformity nor the minimum
+void TerrainCosts::UpdateSummary() {
+    minimum_cost_ = 0.0f;
+    is_uniform_ = true;
+    for (int type = 0; type < kTileTypeCount; ++type) {
+        if (Tile::IsBlockedType(static_cast<TileType>(type))) continue;
+
+        float cost = type_costs_[type];
+        if (minimum_cost_ == 0.0f || cost < minimum_cost_) {
+            minimum_cost_ = cost;
+        }
+        is_uniform_ = is_uniform_ && cost == 1.0f;
+    }
+}
+
+// ******************** PER-TILE GRID ********************
+
+template<typename TileContainer>
+void TerrainCosts::Synchronize(const Map<TileContainer>& game_map) {
+    bool same_map = map_identity_ == &game_map && width_ == game_map.GetWidth() &&
+                    height_ == game_map.GetHeight();
+    if (same_map && grid_table_revision_ == table_revision_ && map_revision_ == game_map.GetRevision()) {
+        return;
+    }
+
+    std::vector<Position> changed_tiles;
+    if (same_map && grid_table_revision_ == table_revision_ &&
+        game_map.GetTileChangesSince(map_revision_, changed_tiles)) {
+        for (const Position& pos : changed_tiles) {
+            tile_costs_[pos.y * width_ + pos.x] = GetCost(game_map.GetTile(pos).GetType());
+        }
+    } else {
+        width_ = game_map.GetWidth();
+        height_ = game_map.GetHeight();
+        tile_costs_.resize(static_cast<size_t>(width_) * height_);
+        for (int y = 0; y < height_; ++y) {
+            for (int x = 0; x < width_; ++x) {
+                tile_costs_[y * width_ + x] = GetCost(game_map.GetTile(x, y).GetType());
+            }
+        }
+    }
+
+    map_identity_ = &game_map;
+    map_revision_ = game_map.GetRevision();
+    grid_table_revision_ = table_revision_;
+}
+
+// ******************** REPORTING ********************
+
+void TerrainCosts::PrintCostTable() const {
+    std::cout << "Terrain costs" << (is_uniform_ ? " (uniform)" : "") << ":" << std::endl;
+    for (int type = 0; type < kTileTypeCount; ++type) {
+        Tile tile(static_cast<TileType>(type), 0, 0);
+        if (!tile.IsTraversable()) continue;
+        std::cout << "  " << tile.GetTypeName() << ": " << type_costs_[type] << std::endl;
+    }
+}
+
+// ******************** EXPLICIT TEMPLATE INSTANTIATIONS ********************
+
+template void TerrainCosts::Synchronize<std::vector<std::vector<Tile>>>(
+        const Map<std::vector<std::vector<Tile>>>& game_map);
+
+// Flat row-major grid (the default Map<> container)
+
+template void TerrainCosts::Synchronize<FlatTileGrid>(
+        const Map<FlatTileGrid>& game_map);
+
+// Morton-ordered 8x8 blocks
+
+template void TerrainCosts::Synchronize<MortonTileGrid>(
+        const Map<MortonTileGrid>& game_map);
+
+// Type byte plus bit planes
+
+template void TerrainCosts::Synchronize<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map);
+
+// Build-time 64x64 grid
+
+template void TerrainCosts::Synchronize<FixedGrid<64, 64>>(
+        const Map<FixedGrid<64, 64>>& game_map);
+
+// Streamed 64x64 chunks
+
+template void TerrainCosts::Synchronize<ChunkedTileGrid>(
+        const Map<ChunkedTileGrid>& game_map);
+
+// Memory-mapped map file
+
+template void TerrainCosts::Synchronize<MappedTileGrid>(
+        const Map<MappedTileGrid>& game_map);
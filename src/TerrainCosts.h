@@ -0,0 +1,61 @@
+#ifndef RAYLIBSTARTER_TERRAINCOSTS_H
+#define RAYLIBSTARTER_TERRAINCOSTS_H
+
+#include "Tile.h"
+#include <vector>
+
+// Forward declaration
+template<typename TileContainer> class Map;
+
+// ******************** TERRAIN COSTS ********************
+
+// Cost of entering a tile, set per TileType at runtime. Searches read a packed per-tile grid
+// built from the table, so a weighted step is one array load, the same as a uniform one.
+// Every type starts at 1, which keeps the original unit-cost behaviour.
+class TerrainCosts {
+public:
+    // Smallest accepted cost; keeps the scaled heuristic positive
+    static const float kMinimumTypeCost;
+
+    // Constructor
+    TerrainCosts();
+
+    // Destructor
+    ~TerrainCosts();
+
+    // Cost table
+    void SetCost(TileType type, float cost);
+    float GetCost(TileType type) const { return type_costs_[static_cast<int>(type)]; }
+    void ResetToUniform();
+    bool IsUniform() const { return is_uniform_; }
+
+    // Cheapest traversable type: multiplying a unit-cost heuristic by it keeps it admissible
+    float GetMinimumCost() const { return minimum_cost_; }
+
+    // Brings the per-tile grid up to date, rewriting only changed tiles when the table is unchanged
+    template<typename TileContainer>
+    void Synchronize(const Map<TileContainer>& game_map);
+
+    // Per-tile cost, row-major; valid after Synchronize
+    float GetTileCost(int index) const { return tile_costs_[index]; }
+
+    void PrintCostTable() const;
+
+private:
+    float type_costs_[kTileTypeCount];
+    float minimum_cost_;
+    bool is_uniform_;
+    unsigned int table_revision_;
+
+    // Grid snapshot
+    int width_;
+    int height_;
+    std::vector<float> tile_costs_;
+    const void* map_identity_;
+    unsigned long long map_revision_;
+    unsigned int grid_table_revision_;
+
+    void UpdateSummary();
+};
+
+#endif //RAYLIBSTARTER_TERRAINCOSTS_H
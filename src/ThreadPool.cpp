@@ -0,0 +1,97 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+// ******************** CONSTRUCTOR & DESTRUCTOR ********************
+
+ThreadPool::ThreadPool(int thread_count)
+        : task_(nullptr), task_count_(0), next_task_(0), generation_(0), active_workers_(0), stopping_(false) {
+    if (thread_count <= 0) {
+        thread_count = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    for (int i = 1; i < thread_count; ++i) {
+        workers_.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+ThreadPool& ThreadPool::GetShared() {
+    static ThreadPool shared_pool;
+    return shared_pool;
+}
+
+// ******************** PARALLEL LOOPS ********************
+
+void ThreadPool::ParallelFor(int task_count, const std::function<void(int)>& task) {
+    if (task_count <= 0) return;
+
+    std::lock_guard<std::mutex> run_lock(run_mutex_);
+    if (workers_.empty() || task_count == 1) {
+        for (int i = 0; i < task_count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        task_count_ = task_count;
+        next_task_.store(0);
+        generation_++;
+    }
+    wake_.notify_all();
+
+    RunTasks(task, task_count, next_task_);
+
+    // Workers that joined this loop may still be running their last task
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this]() { return active_workers_ == 0; });
+    task_ = nullptr;
+}
+
+void ThreadPool::WorkerLoop() {
+    unsigned long long seen_generation = 0;
+
+    for (;;) {
+        const std::function<void(int)>* task;
+        int task_count;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&]() { return stopping_ || generation_ != seen_generation; });
+            if (stopping_) return;
+
+            // A worker that wakes after its loop finished finds no task and goes back to sleep
+            seen_generation = generation_;
+            if (!task_) continue;
+            task = task_;
+            task_count = task_count_;
+            active_workers_++;
+        }
+
+        RunTasks(*task, task_count, next_task_);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            active_workers_--;
+        }
+        done_.notify_one();
+    }
+}
+
+void ThreadPool::RunTasks(const std::function<void(int)>& task, int task_count, std::atomic<int>& next_task) {
+    for (int i = next_task.fetch_add(1); i < task_count; i = next_task.fetch_add(1)) {
+        task(i);
+    }
+}
@@ -0,0 +1,55 @@
+#ifndef RAYLIBSTARTER_THREADPOOL_H
+#define RAYLIBSTARTER_THREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+// ******************** THREAD POOL CLASS ********************
+
+// Fixed set of worker threads for data-parallel loops. ParallelFor hands out task indices to the
+// workers and the calling thread and returns once every task has run. One loop runs at a time;
+// a task must not start another loop on the same pool.
+class ThreadPool {
+public:
+    // thread_count counts the calling thread; 0 uses one thread per hardware thread
+    explicit ThreadPool(int thread_count = 0);
+
+    // Destructor
+    ~ThreadPool();
+
+    // Workers wait on this object's state, so a pool cannot be copied
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Runs task(0) .. task(task_count - 1), in no particular order
+    void ParallelFor(int task_count, const std::function<void(int)>& task);
+
+    int GetThreadCount() const { return static_cast<int>(workers_.size()) + 1; }
+
+    // Pool shared by map generation and other whole-map passes
+    static ThreadPool& GetShared();
+
+private:
+    std::vector<std::thread> workers_;
+    std::mutex run_mutex_;      // Serialises ParallelFor callers
+
+    // Current loop, guarded by mutex_ except for the task counter
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void(int)>* task_;
+    int task_count_;
+    std::atomic<int> next_task_;
+    unsigned long long generation_;
+    int active_workers_;
+    bool stopping_;
+
+    void WorkerLoop();
+    static void RunTasks(const std::function<void(int)>& task, int task_count, std::atomic<int>& next_task);
+};
+
+#endif //RAYLIBSTARTER_THREADPOOL_H
@@ -4,36 +4,33 @@
 
 // ******************** UTILITY FUNCTIONS ********************
 
-bool Tile::IsBlockedType(TileType type) {
-    return type >= TileType::BLOCKED_STONE && type <= TileType::BLOCKED_WATER;
-}
+static const TileType kBlockedTypes[] = {
+        TileType::BLOCKED_STONE,
+        TileType::BLOCKED_BUSHES,
+        TileType::BLOCKED_TREE,
+        TileType::BLOCKED_WATER
+};
+
+static const TileType kTraversableTypes[] = {
+        TileType::TRAVERSABLE_DIRT,
+        TileType::TRAVERSABLE_STONE,
+        TileType::TRAVERSABLE_GRASS
+};
 
-bool Tile::IsTraversableType(TileType type) {
-    return (type >= TileType::TRAVERSABLE_DIRT && type <= TileType::TRAVERSABLE_GRASS) ||
-           IsTreasureChestType(type);
+TileType Tile::GetRandomBlockedType() {
+    return kBlockedTypes[GetRandomValue(0, 3)];
 }
 
-bool Tile::IsTreasureChestType(TileType type) {
-    return type == TileType::TREASURE_CHEST_CLOSED || type == TileType::TREASURE_CHEST_OPENED;
+TileType Tile::GetRandomTraversableType() {
+    return kTraversableTypes[GetRandomValue(0, 2)];
 }
 
-TileType Tile::GetRandomBlockedType() {
-    TileType blocked_types[] = {
-            TileType::BLOCKED_STONE,
-            TileType::BLOCKED_BUSHES,
-            TileType::BLOCKED_TREE,
-            TileType::BLOCKED_WATER
-    };
-    return blocked_types[GetRandomValue(0, 3)];
+TileType Tile::GetRandomBlockedType(CounterRng& rng) {
+    return kBlockedTypes[rng.Range(0, 3)];
 }
 
-TileType Tile::GetRandomTraversableType() {
-    TileType traversable_types[] = {
-            TileType::TRAVERSABLE_DIRT,
-            TileType::TRAVERSABLE_STONE,
-            TileType::TRAVERSABLE_GRASS
-    };
-    return traversable_types[GetRandomValue(0, 2)];
+TileType Tile::GetRandomTraversableType(CounterRng& rng) {
+    return kTraversableTypes[rng.Range(0, 2)];
 }
 
 // ******************** CONSTRUCTORS ********************
@@ -74,10 +71,6 @@ Color Tile::GetColor() const {
     return GetColorForType(type_);
 }
 
-bool Tile::IsTraversable() const {
-    return IsTraversableType(type_) || type_ == TileType::START || type_ == TileType::END;
-}
-
 bool Tile::IsTreasureChest() const {
     return IsTreasureChestType(type_);
 }
@@ -2,7 +2,9 @@
 #define RAYLIBSTARTER_TILE_H
 
 #include "raylib.h"
+#include "CounterRng.h"
 #include <string>
+#include <cstdint>
 
 // ******************** TILE TYPES ********************
 
@@ -26,6 +28,37 @@ enum class TileType {
     TREASURE_CHEST_OPENED
 };
 
+// ******************** TILE TYPE PROPERTIES ********************
+
+constexpr int kTileTypeCount = static_cast<int>(TileType::TREASURE_CHEST_OPENED) + 1;
+
+// Property bits per TileType; every type predicate is a single table load
+enum TileTypeFlag : uint8_t {
+    kTileFlagTraversable = 1 << 0,  // Can be stood on: open terrain, chests, START and END
+    kTileFlagOpenTerrain = 1 << 1,  // Traversable terrain or chest, not START/END
+    kTileFlagBlocked = 1 << 2,
+    kTileFlagChest = 1 << 3,
+    kTileFlagBlastable = 1 << 4     // Blocked tiles a bomb can clear
+};
+
+constexpr uint8_t kTileTypeFlags[kTileTypeCount] = {
+        kTileFlagTraversable,                                           // START
+        kTileFlagTraversable,                                           // END
+        kTileFlagBlocked | kTileFlagBlastable,                          // BLOCKED_STONE
+        kTileFlagBlocked | kTileFlagBlastable,                          // BLOCKED_BUSHES
+        kTileFlagBlocked,                                               // BLOCKED_TREE
+        kTileFlagBlocked,                                               // BLOCKED_WATER
+        kTileFlagTraversable | kTileFlagOpenTerrain,                    // TRAVERSABLE_DIRT
+        kTileFlagTraversable | kTileFlagOpenTerrain,                    // TRAVERSABLE_STONE
+        kTileFlagTraversable | kTileFlagOpenTerrain,                    // TRAVERSABLE_GRASS
+        kTileFlagTraversable | kTileFlagOpenTerrain | kTileFlagChest,   // TREASURE_CHEST_CLOSED
+        kTileFlagTraversable | kTileFlagOpenTerrain | kTileFlagChest    // TREASURE_CHEST_OPENED
+};
+
+constexpr bool TileTypeHasFlag(TileType type, uint8_t flag) {
+    return (kTileTypeFlags[static_cast<int>(type)] & flag) != 0;
+}
+
 // ******************** POSITION STRUCT ********************
 
 struct Position {
@@ -49,11 +82,14 @@ struct Position {
 class Tile {
 public:
     // Utility functions for tile type logic
-    static bool IsBlockedType(TileType type);
-    static bool IsTraversableType(TileType type);
-    static bool IsTreasureChestType(TileType type);
+    static constexpr bool IsBlockedType(TileType type) { return TileTypeHasFlag(type, kTileFlagBlocked); }
+    static constexpr bool IsTraversableType(TileType type) { return TileTypeHasFlag(type, kTileFlagOpenTerrain); }
+    static constexpr bool IsTreasureChestType(TileType type) { return TileTypeHasFlag(type, kTileFlagChest); }
+    static constexpr bool IsBlastableType(TileType type) { return TileTypeHasFlag(type, kTileFlagBlastable); }
     static TileType GetRandomBlockedType();
     static TileType GetRandomTraversableType();
+    static TileType GetRandomBlockedType(CounterRng& rng);
+    static TileType GetRandomTraversableType(CounterRng& rng);
 
     // Constructors
     Tile();
@@ -68,7 +104,7 @@ public:
     Position GetPosition() const;
     char GetCharRepresentation() const;
     Color GetColor() const;
-    bool IsTraversable() const;
+    bool IsTraversable() const { return TileTypeHasFlag(type_, kTileFlagTraversable); }
     bool IsTreasureChest() const;
     bool IsClosedTreasureChest() const;
     bool IsOpenTreasureChest() const;
@@ -0,0 +1,37 @@
+#include "TileUnionFind.h"
+
+// ******************** SET OPERATIONS ********************
+
+void TileUnionFind::Reset(int tile_count) {
+    parents_.resize(tile_count);
+    for (int i = 0; i < tile_count; ++i) {
+        parents_[i] = i;
+    }
+    ranks_.assign(tile_count, 0);
+}
+
+int TileUnionFind::Find(int tile) {
+    while (parents_[tile] != tile) {
+        parents_[tile] = parents_[parents_[tile]];
+        tile = parents_[tile];
+    }
+    return tile;
+}
+
+bool TileUnionFind::Unite(int first_tile, int second_tile) {
+    int first_root = Find(first_tile);
+    int second_root = Find(second_tile);
+    if (first_root == second_root) {
+        return false;
+    }
+
+    if (ranks_[first_root] < ranks_[second_root]) {
+        parents_[first_root] = second_root;
+    } else {
+        parents_[second_root] = first_root;
+        if (ranks_[first_root] == ranks_[second_root]) {
+            ranks_[first_root]++;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,31 @@
+#ifndef RAYLIBSTARTER_TILEUNIONFIND_H
+#define RAYLIBSTARTER_TILEUNIONFIND_H
+
+#include <vector>
+#include <cstdint>
+
+// ******************** TILE UNION-FIND ********************
+
+// Disjoint sets over tile indices (y * width + x) with union by rank and path halving, so a
+// sequence of Unite/Find calls runs in near-linear time. Map generation uses it to find the
+// traversable regions that are cut off from the start tile.
+class TileUnionFind {
+public:
+    TileUnionFind() = default;
+
+    // Every tile in a set of its own
+    void Reset(int tile_count);
+
+    int Find(int tile);
+
+    // Returns false if both tiles were already in the same set
+    bool Unite(int first_tile, int second_tile);
+
+    bool IsConnected(int first_tile, int second_tile) { return Find(first_tile) == Find(second_tile); }
+
+private:
+    std::vector<int> parents_;
+    std::vector<uint8_t> ranks_;
+};
+
+#endif //RAYLIBSTARTER_TILEUNIONFIND_H
@@ -0,0 +1,58 @@
+#ifndef RAYLIBSTARTER_TILEVIEW_H
+#define RAYLIBSTARTER_TILEVIEW_H
+
+#include "Tile.h"
+#include <string>
+
+// ******************** TILE VIEW ********************
+
+// The Tile API over one cell of a grid that stores tile types instead of Tile objects
+// (CompactTileGrid, MappedTileGrid). A view is two ints and a pointer, is made on every
+// tiles[y][x] and converts to a Tile when a full copy is needed. Grid provides GetType,
+// IsTraversable, IsTreasureChest and SetType by (x, y); a const Grid gives a read-only view.
+template<typename Grid>
+class BasicTileView {
+public:
+    BasicTileView(Grid* grid, int x, int y) : grid_(grid), x_(x), y_(y) {}
+
+    // Getters
+    TileType GetType() const { return grid_->GetType(x_, y_); }
+    Position GetPosition() const { return Position(x_, y_); }
+    char GetCharRepresentation() const { return ToTile().GetCharRepresentation(); }
+    Color GetColor() const { return ToTile().GetColor(); }
+    bool IsTraversable() const { return grid_->IsTraversable(x_, y_); }
+    bool IsTreasureChest() const { return grid_->IsTreasureChest(x_, y_); }
+    bool IsClosedTreasureChest() const { return GetType() == TileType::TREASURE_CHEST_CLOSED; }
+    bool IsOpenTreasureChest() const { return GetType() == TileType::TREASURE_CHEST_OPENED; }
+
+    // Setters (the position is the cell's, so only the type of an assigned Tile is kept)
+    void SetType(TileType type) const { grid_->SetType(x_, y_, type); }
+    const BasicTileView& operator=(const Tile& tile) const {
+        SetType(tile.GetType());
+        return *this;
+    }
+
+    // Treasure chest operations
+    void OpenTreasureChest() const {
+        if (IsClosedTreasureChest()) SetType(TileType::TREASURE_CHEST_OPENED);
+    }
+    void CloseTreasureChest() const {
+        if (IsOpenTreasureChest()) SetType(TileType::TREASURE_CHEST_CLOSED);
+    }
+
+    // Rendering
+    void Render(int screen_x, int screen_y, int tile_size) const { ToTile().Render(screen_x, screen_y, tile_size); }
+    void RenderConsole() const { ToTile().RenderConsole(); }
+
+    // Utility
+    std::string GetTypeName() const { return ToTile().GetTypeName(); }
+    Tile ToTile() const { return Tile(GetType(), x_, y_); }
+    operator Tile() const { return ToTile(); }
+
+private:
+    Grid* grid_;
+    int x_;
+    int y_;
+};
+
+#endif //RAYLIBSTARTER_TILEVIEW_H
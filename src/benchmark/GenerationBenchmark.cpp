@@ -0,0 +1,166 @@
+#include "GenerationBenchmark.h"
+#include "../Map.h"
+#include "../ThreadPool.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include <algorithm>
+#include <random>
+
+// ******************** STATIC MEMBER DEFINITIONS ********************
+
+const uint8_t GenerationBenchmark::kChestTile;
+
+// ******************** EXECUTION ********************
+
+template<typename TileContainer>
+GenerationReport GenerationBenchmark::Run(const std::string& layout, Map<TileContainer>& game_map, int threads,
+                                          uint64_t seed) {
+    ThreadPool pool(threads);
+    game_map.SetGenerationThreadPool(&pool);
+
+    GenerationReport report;
+    report.layout = layout;
+    report.threads = pool.GetThreadCount();
+
+    auto start_time = std::chrono::steady_clock::now();
+    game_map.GenerateTerrainWithClustering(seed);
+    auto end_time = std::chrono::steady_clock::now();
+
+    game_map.SetGenerationThreadPool(nullptr);
+    report.wall_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count();
+    return report;
+}
+
+// ******************** TERRAIN COMPARISON ********************
+
+template<typename TileContainer>
+std::vector<uint8_t> GenerationBenchmark::CaptureTerrain(const Map<TileContainer>& game_map) {
+    std::vector<uint8_t> terrain;
+    terrain.reserve(static_cast<size_t>(game_map.GetWidth()) * game_map.GetHeight());
+    for (int y = 0; y < game_map.GetHeight(); ++y) {
+        for (int x = 0; x < game_map.GetWidth(); ++x) {
+            const auto& tile = game_map.GetTile(x, y);
+            terrain.push_back(tile.IsTreasureChest() ? kChestTile : static_cast<uint8_t>(tile.GetType()));
+        }
+    }
+    return terrain;
+}
+
+long long GenerationBenchmark::CountDifferences(const std::vector<uint8_t>& reference,
+                                                const std::vector<uint8_t>& terrain) {
+    if (reference.size() != terrain.size()) {
+        return static_cast<long long>(std::max(reference.size(), terrain.size()));
+    }
+
+    long long differences = 0;
+    for (size_t i = 0; i < reference.size(); ++i) {
+        if (reference[i] != terrain[i] && reference[i] != kChestTile && terrain[i] != kChestTile) {
+            differences++;
+        }
+    }
+    return differences;
+}
+
+long long GenerationBenchmark::CheckNeighborCounts(int width, int height, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    NeighborMask mask;
+    mask.Resize(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            mask.Set(x, y, (rng() & 1) != 0);
+        }
+    }
+
+    std::vector<uint8_t> counts(static_cast<size_t>(width) * height);
+    std::vector<uint8_t> scalar_counts(counts.size());
+    mask.CountNeighbors(0, height, counts.data());
+    mask.CountNeighborsScalar(0, height, scalar_counts.data());
+
+    long long differences = 0;
+    for (size_t i = 0; i < counts.size(); ++i) {
+        if (counts[i] != scalar_counts[i]) {
+            differences++;
+        }
+    }
+    return differences;
+}
+
+// ******************** COMMAND LINE ENTRY ********************
+
+int GenerationBenchmark::RunFromCommandLine(int argc, char** argv) {
+    int size = argc >= 1 ? std::atoi(argv[0]) : 4096;
+    uint64_t seed = argc >= 2 ? std::strtoull(argv[1], nullptr, 10) : 12345u;
+    if (size < 15) {
+        std::cout << "Usage: [size >= 15] [seed]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int max_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    std::vector<int> thread_counts;
+    for (int threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    // Item generation prints every item; the timed runs include it but it is tiny next to the terrain
+    Map<FlatTileGrid> flat_map(size, size);
+    Map<CompactTileGrid> compact_map(size, size);
+
+    std::vector<GenerationReport> reports;
+    std::vector<uint8_t> reference_terrain;
+    for (int threads : thread_counts) {
+        reports.push_back(Run("row-major", flat_map, threads, seed));
+        if (reference_terrain.empty()) {
+            reference_terrain = CaptureTerrain(flat_map);
+        } else {
+            reports.back().differing_tiles = CountDifferences(reference_terrain, CaptureTerrain(flat_map));
+        }
+    }
+    reports.push_back(Run("compact", compact_map, max_threads, seed));
+    reports.back().differing_tiles = CountDifferences(reference_terrain, CaptureTerrain(compact_map));
+
+    std::cout << "\n" << std::string(64, '=') << std::endl;
+    std::cout << "      CLUSTERED GENERATION: " << size << "x" << size << ", seed " << seed << std::endl;
+    std::cout << std::string(64, '=') << std::endl;
+    std::cout << "Layout     | Threads |      ms | MTiles/s | Differing tiles" << std::endl;
+    std::cout << "-----------|---------|---------|----------|----------------" << std::endl;
+
+    double tile_count = static_cast<double>(size) * size;
+    bool all_equal = true;
+    for (const GenerationReport& report : reports) {
+        all_equal = all_equal && report.differing_tiles == 0;
+
+        std::cout << std::left << std::setw(10) << report.layout << std::right
+                  << " | " << std::setw(7) << report.threads
+                  << " | " << std::setw(7) << std::fixed << std::setprecision(1) << (report.wall_time_ns / 1e6)
+                  << " | " << std::setw(8) << (tile_count / (report.wall_time_ns / 1e3))
+                  << " | " << report.differing_tiles << std::defaultfloat << std::endl;
+    }
+    std::cout << std::string(64, '=') << std::endl;
+
+    // An odd width leaves a tail for the scalar loop after the 32-cell vector steps
+    long long count_differences = CheckNeighborCounts(size + 7, std::min(size, 1024), seed);
+    std::cout << "Neighbour counts: " << (NeighborMask::kUsesAvx2 ? "AVX2" : "scalar") << ", "
+              << count_differences << " differing from the scalar loop" << std::endl;
+    all_equal = all_equal && count_differences == 0;
+    return all_equal ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ******************** EXPLICIT TEMPLATE INSTANTIATIONS ********************
+
+template GenerationReport GenerationBenchmark::Run<FlatTileGrid>(
+        const std::string& layout, Map<FlatTileGrid>& game_map, int threads, uint64_t seed);
+
+template std::vector<uint8_t> GenerationBenchmark::CaptureTerrain<FlatTileGrid>(const Map<FlatTileGrid>& game_map);
+
+// Type byte plus bit planes
+
+template GenerationReport GenerationBenchmark::Run<CompactTileGrid>(
+        const std::string& layout, Map<CompactTileGrid>& game_map, int threads, uint64_t seed);
+
+template std::vector<uint8_t> GenerationBenchmark::CaptureTerrain<CompactTileGrid>(
+        const Map<CompactTileGrid>& game_map);
@@ -0,0 +1,48 @@
+#ifndef RAYLIBSTARTER_GENERATIONBENCHMARK_H
+#define RAYLIBSTARTER_GENERATIONBENCHMARK_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Forward declaration
+template<typename TileContainer> class Map;
+
+// ******************** GENERATION REPORT STRUCTURE ********************
+
+// One clustered-terrain generation of the same seed
+struct GenerationReport {
+    std::string layout;
+    int threads;
+    long long wall_time_ns;
+    long long differing_tiles;  // Against the first run; must be 0, since the seed is the same
+
+    GenerationReport() : threads(0), wall_time_ns(0), differing_tiles(0) {}
+};
+
+// ******************** GENERATION BENCHMARK CLASS ********************
+
+// Times Map::GenerateTerrainWithClustering for one seed on growing thread pools and checks that
+// every run produces the same terrain. Items still come from raylib's generator, so treasure
+// chest tiles are left out of the comparison.
+class GenerationBenchmark {
+public:
+    static const uint8_t kChestTile = 0xFF;
+
+    template<typename TileContainer>
+    static GenerationReport Run(const std::string& layout, Map<TileContainer>& game_map, int threads, uint64_t seed);
+
+    // Row-major tile types, kChestTile for treasure chests
+    template<typename TileContainer>
+    static std::vector<uint8_t> CaptureTerrain(const Map<TileContainer>& game_map);
+    static long long CountDifferences(const std::vector<uint8_t>& reference, const std::vector<uint8_t>& terrain);
+
+    // NeighborMask row sweep against its scalar loop on a random mask; returns the differing
+    // counts (0 unless the AVX2 path is wrong, and trivially 0 when it is not compiled in)
+    static long long CheckNeighborCounts(int width, int height, uint64_t seed);
+
+    // Command line entry, arguments after --generate: [size] [seed]
+    static int RunFromCommandLine(int argc, char** argv);
+};
+
+#endif //RAYLIBSTARTER_GENERATIONBENCHMARK_H
@@ -0,0 +1,516 @@
+#include "LayoutBenchmark.h"
+#include "../Map.h"
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <chrono>
+#include <algorithm>
+
+// ******************** STATIC MEMBER DEFINITIONS ********************
+
+const int LayoutBenchmark::kBoundedExpansionLimit;
+
+// ******************** SETUP ********************
+
+std::vector<TileType> LayoutBenchmark::GenerateTerrain(int width, int height, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> roll(0.0f, 1.0f);
+
+    // Same mix as Map::GenerateBlockedTiles, without the recursive path check that large maps overflow
+    std::vector<TileType> tile_types(static_cast<size_t>(width) * height);
+    for (TileType& type : tile_types) {
+        if (roll(rng) < 0.3f) {
+            type = roll(rng) < 0.5f ? TileType::BLOCKED_TREE : TileType::BLOCKED_STONE;
+        } else {
+            type = roll(rng) < 0.5f ? TileType::TRAVERSABLE_GRASS : TileType::TRAVERSABLE_DIRT;
+        }
+    }
+    return tile_types;
+}
+
+std::vector<LayoutBenchmark::Query> LayoutBenchmark::GenerateQueries(const std::vector<TileType>& tile_types,
+                                                                     int width, int height, int count,
+                                                                     unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> pick_x(0, width - 1);
+    std::uniform_int_distribution<int> pick_y(0, height - 1);
+
+    auto random_open_tile = [&]() {
+        for (;;) {
+            Position pos(pick_x(rng), pick_y(rng));
+            TileType type = tile_types[static_cast<size_t>(pos.y) * width + pos.x];
+            if (type == TileType::TRAVERSABLE_GRASS || type == TileType::TRAVERSABLE_DIRT) {
+                return pos;
+            }
+        }
+    };
+
+    std::vector<Query> queries;
+    queries.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        Position start = random_open_tile();
+        queries.emplace_back(start, random_open_tile());
+    }
+    return queries;
+}
+
+// ******************** EXECUTION ********************
+
+template<typename TileContainer>
+LayoutReport LayoutBenchmark::RunQueries(const std::string& layout, const Map<TileContainer>& game_map,
+                                         const std::vector<Query>& queries, PathfindingAlgorithm algorithm) {
+    LayoutReport report;
+    report.layout = layout;
+    report.algorithm_name = Pathfinding::GetAlgorithmName(algorithm);
+
+    // Fresh pathfinder per layout; one untimed query builds the per-map analyses and workspaces
+    Pathfinding pathfinder;
+    pathfinder.SetVerbose(false);
+    if (!queries.empty()) {
+        pathfinder.FindPath(algorithm, queries.front().first, queries.front().second, game_map);
+    }
+
+    report.costs.reserve(queries.size());
+    for (const Query& query : queries) {
+        PathResult result = pathfinder.FindPath(algorithm, query.first, query.second, game_map);
+        report.queries++;
+        report.total_wall_time_ns += result.stats.wall_time_ns;
+        report.total_expansions += result.nodes_explored;
+        if (result.path_found) {
+            report.solved++;
+            report.costs.push_back(result.total_cost);
+        } else {
+            report.costs.push_back(-1.0f);
+        }
+    }
+    return report;
+}
+
+template<typename TileContainer>
+LayoutReport LayoutBenchmark::RunBreadthFirstQueries(const std::string& layout, const Map<TileContainer>& game_map,
+                                                     const std::vector<Query>& queries) {
+    LayoutReport report;
+    report.layout = layout;
+    report.algorithm_name = "BFS";
+
+    // One untimed query sizes the workspace
+    Pathfinding pathfinder;
+    pathfinder.SetVerbose(false);
+    std::vector<Position> goal(1);
+    if (!queries.empty()) {
+        goal[0] = queries.front().second;
+        pathfinder.FindNearest(queries.front().first, goal, game_map);
+    }
+
+    report.costs.reserve(queries.size());
+    for (const Query& query : queries) {
+        goal[0] = query.second;
+        PathResult result = pathfinder.FindNearest(query.first, goal, game_map);
+        report.queries++;
+        report.total_wall_time_ns += result.stats.wall_time_ns;
+        report.total_expansions += result.nodes_explored;
+        if (result.path_found) {
+            report.solved++;
+            report.costs.push_back(result.total_cost);
+        } else {
+            report.costs.push_back(-1.0f);
+        }
+    }
+    return report;
+}
+
+void LayoutBenchmark::CompareCosts(const LayoutReport& reference, LayoutReport& report) {
+    report.cost_mismatches = 0;
+    for (size_t i = 0; i < report.costs.size() && i < reference.costs.size(); ++i) {
+        if (std::fabs(report.costs[i] - reference.costs[i]) > 1e-3f) {
+            report.cost_mismatches++;
+        }
+    }
+}
+
+template<typename TileContainer>
+std::vector<LayoutBenchmark::Query> LayoutBenchmark::GenerateLocalQueries(const Map<TileContainer>& game_map,
+                                                                          int count, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> pick_x(0, game_map.GetWidth() - 1);
+    std::uniform_int_distribution<int> pick_y(0, game_map.GetHeight() - 1);
+    std::uniform_int_distribution<int> offset(-300, 300);
+    auto random_open_tile = [&](int near_x, int near_y, bool is_near) {
+        for (;;) {
+            int x = is_near ? near_x + offset(rng) : pick_x(rng);
+            int y = is_near ? near_y + offset(rng) : pick_y(rng);
+            if (game_map.IsValidPosition(x, y) && game_map.GetTile(x, y).IsTraversable()) {
+                return Position(x, y);
+            }
+        }
+    };
+
+    std::vector<Query> queries;
+    queries.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        Position start = random_open_tile(0, 0, false);
+        queries.emplace_back(start, random_open_tile(start.x, start.y, true));
+    }
+    return queries;
+}
+
+template<typename TileContainer>
+LayoutReport LayoutBenchmark::RunBoundedQueries(const std::string& layout, const Map<TileContainer>& game_map,
+                                                const std::vector<Query>& queries, bool eight_way) {
+    LayoutReport report;
+    report.layout = layout;
+    report.algorithm_name = Pathfinding::GetAlgorithmName(eight_way ? PathfindingAlgorithm::A_STAR_OCTILE
+                                                                    : PathfindingAlgorithm::A_STAR);
+
+    SearchLimits limits(kBoundedExpansionLimit);
+    Pathfinding pathfinder;
+    pathfinder.SetVerbose(false);
+
+    report.costs.reserve(queries.size());
+    for (const Query& query : queries) {
+        PathResult result = eight_way
+                ? pathfinder.FindPathAStarWithMovement<EightWayMovement<DiagonalRule::BOTH_SIDES_FREE>>(
+                        query.first, query.second, game_map, limits)
+                : pathfinder.FindPathAStar(query.first, query.second, game_map, limits);
+        report.queries++;
+        report.total_wall_time_ns += result.stats.wall_time_ns;
+        report.total_expansions += result.nodes_explored;
+        if (result.path_found) {
+            report.solved++;
+            report.costs.push_back(result.total_cost);
+        } else {
+            report.costs.push_back(-1.0f);
+        }
+    }
+    return report;
+}
+
+// ******************** REPORTING ********************
+
+void LayoutBenchmark::PrintReport(const std::vector<LayoutReport>& reports, int width, int height) {
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "           TILE LAYOUT BENCHMARK: " << width << "x" << height << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    std::cout << "Algorithm  | Layout         | Queries | Solved | Mismatch | Avg us | Avg Exp | ns/Exp" << std::endl;
+    std::cout << "-----------|----------------|---------|--------|----------|--------|---------|-------" << std::endl;
+
+    for (const LayoutReport& report : reports) {
+        int queries = std::max(1, report.queries);
+        double ns_per_expansion = report.total_expansions > 0
+                                  ? static_cast<double>(report.total_wall_time_ns) / report.total_expansions
+                                  : 0.0;
+
+        std::cout << std::left << std::setw(10) << report.algorithm_name
+                  << " | " << std::setw(14) << report.layout << std::right
+                  << " | " << std::setw(7) << report.queries
+                  << " | " << std::setw(6) << report.solved
+                  << " | " << std::setw(8) << report.cost_mismatches
+                  << " | " << std::setw(6) << (report.total_wall_time_ns / queries / 1000)
+                  << " | " << std::setw(7) << (report.total_expansions / queries)
+                  << " | " << std::setw(6) << std::fixed << std::setprecision(1) << ns_per_expansion
+                  << std::defaultfloat << std::endl;
+    }
+    std::cout << std::string(80, '=') << std::endl;
+}
+
+void LayoutBenchmark::PrintStorage(int width, int height) {
+    size_t tile_count = static_cast<size_t>(width) * height;
+    MortonTileGrid morton;
+    morton.Resize(width, height);
+    CompactTileGrid compact;
+    compact.Resize(width, height);
+
+    std::cout << "Tile storage: row-major " << (tile_count * sizeof(Tile) / 1024)
+              << " KB, nested vectors " << ((tile_count * sizeof(Tile) + height * sizeof(std::vector<Tile>)) / 1024)
+              << " KB, morton 8x8 " << (morton.GetStorageSize() * sizeof(Tile) / 1024)
+              << " KB, compact " << (compact.GetStorageBytes() / 1024) << " KB" << std::endl;
+}
+
+long long LayoutBenchmark::CheckMortonCodes(int width, int height) {
+    long long mismatches = 0;
+    for (uint32_t y = 0; y < static_cast<uint32_t>(height); ++y) {
+        for (uint32_t x = 0; x < static_cast<uint32_t>(width); ++x) {
+            uint32_t code = MortonEncode(x, y);
+            uint32_t decoded_x = 0;
+            uint32_t decoded_y = 0;
+            MortonDecode(code, decoded_x, decoded_y);
+            uint32_t scalar_x = 0;
+            uint32_t scalar_y = 0;
+            MortonDecodeScalar(code, scalar_x, scalar_y);
+            if (code != MortonEncodeScalar(x, y) || decoded_x != scalar_x || decoded_y != scalar_y) {
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+// ******************** COMMAND LINE ENTRY ********************
+
+int LayoutBenchmark::RunFromCommandLine(int argc, char** argv) {
+    int size = argc >= 1 ? std::atoi(argv[0]) : 1024;
+    int query_count = argc >= 2 ? std::atoi(argv[1]) : 200;
+    if (size < 15 || query_count <= 0) {
+        std::cout << "Usage: [size >= 15] [queries > 0]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<TileType> tile_types = GenerateTerrain(size, size, 12345u);
+    std::vector<Query> queries = GenerateQueries(tile_types, size, size, query_count, 67890u);
+
+    // Same terrain in every layout
+    Map<std::vector<std::vector<Tile>>> nested_map;
+    Map<FlatTileGrid> flat_map;
+    Map<MortonTileGrid> morton_map;
+    Map<CompactTileGrid> compact_map;
+    nested_map.LoadTerrain(size, size, tile_types);
+    flat_map.LoadTerrain(size, size, tile_types);
+    morton_map.LoadTerrain(size, size, tile_types);
+    compact_map.LoadTerrain(size, size, tile_types);
+
+    // Chunks streamed from the same terrain, with room for a quarter of the map
+    Map<ChunkedTileGrid> chunked_map(size, size);
+    chunked_map.GetTileContainer().SetMemoryCap(static_cast<size_t>(size) * size * sizeof(Tile) / 4);
+    chunked_map.GetTileContainer().SetChunkSource(
+            [&tile_types, size](int chunk_x, int chunk_y, std::vector<TileType>& chunk_types) {
+                for (int i = 0; i < ChunkedTileGrid::kChunkTiles; ++i) {
+                    int x = chunk_x * ChunkedTileGrid::kChunkSize + i % ChunkedTileGrid::kChunkSize;
+                    int y = chunk_y * ChunkedTileGrid::kChunkSize + i / ChunkedTileGrid::kChunkSize;
+                    if (x < size && y < size) {
+                        chunk_types[i] = tile_types[static_cast<size_t>(y) * size + x];
+                    }
+                }
+            });
+
+    // The build-time grid only exists in one size
+    std::unique_ptr<Map<FixedGrid<64, 64>>> fixed_map;
+    if (size == 64) {
+        fixed_map = std::make_unique<Map<FixedGrid<64, 64>>>();
+        fixed_map->LoadTerrain(size, size, tile_types);
+    }
+
+    const PathfindingAlgorithm algorithms[] = {PathfindingAlgorithm::A_STAR, PathfindingAlgorithm::A_STAR_OCTILE};
+
+    std::vector<LayoutReport> reports;
+
+    // Tile-indexed search first: the rows where the layout is what is being measured
+    LayoutReport flat_bfs = RunBreadthFirstQueries("row-major", flat_map, queries);
+    reports.push_back(flat_bfs);
+    std::vector<LayoutReport> bfs_reports;
+    bfs_reports.push_back(RunBreadthFirstQueries("nested vectors", nested_map, queries));
+    bfs_reports.push_back(RunBreadthFirstQueries("morton 8x8", morton_map, queries));
+    bfs_reports.push_back(RunBreadthFirstQueries("compact", compact_map, queries));
+    bfs_reports.push_back(RunBreadthFirstQueries("chunked", chunked_map, queries));
+    if (fixed_map) {
+        bfs_reports.push_back(RunBreadthFirstQueries("fixed 64x64", *fixed_map, queries));
+    }
+    for (LayoutReport& report : bfs_reports) {
+        CompareCosts(flat_bfs, report);
+        reports.push_back(report);
+    }
+
+    for (PathfindingAlgorithm algorithm : algorithms) {
+        LayoutReport flat = RunQueries("row-major", flat_map, queries, algorithm);
+        LayoutReport nested = RunQueries("nested vectors", nested_map, queries, algorithm);
+        LayoutReport morton = RunQueries("morton 8x8", morton_map, queries, algorithm);
+        LayoutReport compact = RunQueries("compact", compact_map, queries, algorithm);
+        CompareCosts(flat, nested);
+        CompareCosts(flat, morton);
+        CompareCosts(flat, compact);
+
+        reports.push_back(flat);
+        reports.push_back(nested);
+        reports.push_back(morton);
+        reports.push_back(compact);
+
+        LayoutReport chunked = RunQueries("chunked", chunked_map, queries, algorithm);
+        CompareCosts(flat, chunked);
+        reports.push_back(chunked);
+
+        if (fixed_map) {
+            LayoutReport fixed = RunQueries("fixed 64x64", *fixed_map, queries, algorithm);
+            CompareCosts(flat, fixed);
+            reports.push_back(fixed);
+        }
+    }
+
+    PrintReport(reports, size, size);
+    PrintStorage(size, size);
+
+    // Morton codes cover 16 bits per coordinate
+    int morton_extent = std::min(size, 1 << 16);
+    long long morton_mismatches = CheckMortonCodes(morton_extent, morton_extent);
+    std::cout << "Morton codes: " << (kMortonUsesBmi2 ? "BMI2 pdep/pext" : "scalar") << ", "
+              << morton_mismatches << " mismatches against the scalar codes" << std::endl;
+    return morton_mismatches == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int LayoutBenchmark::RunStreamedFromCommandLine(int argc, char** argv) {
+    int world_size = argc >= 1 ? std::atoi(argv[0]) : (1 << 20);
+    int query_count = argc >= 2 ? std::atoi(argv[1]) : 100;
+    int cap_mb = argc >= 3 ? std::atoi(argv[2]) : 16;
+    if (world_size < 1024 || query_count <= 0 || cap_mb <= 0) {
+        std::cout << "Usage: [world size >= 1024] [queries > 0] [chunk cache MB > 0]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // A world of world_size² tiles, far more than fits in memory at the default size
+    Map<ChunkedTileGrid> world(world_size, world_size);
+    ChunkedTileGrid& chunks = world.GetTileContainer();
+    chunks.SetChunkSource(ChunkedTileGrid::MakeNoiseSource(12345u));
+    chunks.SetMemoryCap(static_cast<size_t>(cap_mb) * 1024 * 1024);
+
+    // Reads go through a const map so the chunks they load count as unwritten
+    const Map<ChunkedTileGrid>& world_view = world;
+    std::vector<Query> queries = GenerateLocalQueries(world_view, query_count, 67890u);
+
+    std::vector<LayoutReport> reports;
+    reports.push_back(RunBoundedQueries("streamed", world_view, queries, false));
+    reports.push_back(RunBoundedQueries("streamed", world_view, queries, true));
+    PrintReport(reports, world_size, world_size);
+
+    std::cout << "Chunks: " << chunks.GetChunkLoads() << " loaded, " << chunks.GetChunkEvictions() << " evicted, "
+              << chunks.GetResidentChunkCount() << "/" << chunks.GetMaxResidentChunks() << " resident ("
+              << (chunks.GetResidentBytes() / 1024) << " KB)" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+int LayoutBenchmark::RunMapFileFromCommandLine(int argc, char** argv) {
+    int size = argc >= 2 ? std::atoi(argv[1]) : 10000;
+    int query_count = argc >= 3 ? std::atoi(argv[2]) : 100;
+    if (argc < 1 || size < 15 || query_count <= 0) {
+        std::cout << "Usage: <map file> [size >= 15] [queries > 0]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::string file_path = argv[0];
+
+    // Written once; later runs, like other processes, map the same file and share its cached pages
+    MapFile existing_file;
+    if (!existing_file.Open(file_path) || existing_file.GetHeader().width != size ||
+        existing_file.GetHeader().height != size) {
+        existing_file.Close();
+        std::cout << "Writing " << size << "x" << size << " map file " << file_path << std::endl;
+
+        std::vector<TileType> tile_types = GenerateTerrain(size, size, 12345u);
+        std::vector<uint8_t> type_bytes(tile_types.size());
+        for (size_t i = 0; i < tile_types.size(); ++i) {
+            type_bytes[i] = static_cast<uint8_t>(tile_types[i]);
+        }
+
+        MapFileHeader header = {};
+        header.width = size;
+        header.height = size;
+        header.end_x = size - 1;
+        header.end_y = size - 1;
+        if (!MapFile::Write(file_path, header, type_bytes.data(), {})) {
+            return EXIT_FAILURE;
+        }
+    }
+    existing_file.Close();
+
+    // The mapped map attaches the file; the compact map (the smallest copying layout) decodes it
+    Map<MappedTileGrid> mapped_map;
+    Map<CompactTileGrid> copied_map;
+
+    auto load_start = std::chrono::steady_clock::now();
+    bool mapped_ok = mapped_map.LoadMapFile(file_path);
+    auto mapped_end = std::chrono::steady_clock::now();
+    bool copied_ok = copied_map.LoadMapFile(file_path);
+    auto copied_end = std::chrono::steady_clock::now();
+    if (!mapped_ok || !copied_ok) {
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Query> queries = GenerateLocalQueries(mapped_map, query_count, 67890u);
+
+    std::vector<LayoutReport> reports;
+    for (bool eight_way : {false, true}) {
+        LayoutReport copied = RunBoundedQueries("compact copy", copied_map, queries, eight_way);
+        LayoutReport mapped = RunBoundedQueries("mapped", mapped_map, queries, eight_way);
+        CompareCosts(copied, mapped);
+        reports.push_back(copied);
+        reports.push_back(mapped);
+    }
+    PrintReport(reports, size, size);
+
+    std::cout << "Load: mapped " << std::fixed << std::setprecision(2)
+              << std::chrono::duration<double, std::milli>(mapped_end - load_start).count() << " ms, compact copy "
+              << std::chrono::duration<double, std::milli>(copied_end - mapped_end).count() << " ms ("
+              << (static_cast<size_t>(size) * size / (1024 * 1024)) << " MB tile plane)" << std::defaultfloat
+              << std::endl;
+    return EXIT_SUCCESS;
+}
+
+// ******************** EXPLICIT TEMPLATE INSTANTIATIONS ********************
+
+template LayoutReport LayoutBenchmark::RunQueries<std::vector<std::vector<Tile>>>(
+        const std::string& layout, const Map<std::vector<std::vector<Tile>>>& game_map,
+        const std::vector<Query>& queries, PathfindingAlgorithm algorithm);
+
+template LayoutReport LayoutBenchmark::RunBreadthFirstQueries<std::vector<std::vector<Tile>>>(
+        const std::string& layout, const Map<std::vector<std::vector<Tile>>>& game_map,
+        const std::vector<Query>& queries);
+
+// Flat row-major grid (the default Map<> container)
+
+template LayoutReport LayoutBenchmark::RunQueries<FlatTileGrid>(
+        const std::string& layout, const Map<FlatTileGrid>& game_map,
+        const std::vector<Query>& queries, PathfindingAlgorithm algorithm);
+
+template LayoutReport LayoutBenchmark::RunBreadthFirstQueries<FlatTileGrid>(
+        const std::string& layout, const Map<FlatTileGrid>& game_map,
+        const std::vector<Query>& queries);
+
+// Morton-ordered 8x8 blocks
+
+template LayoutReport LayoutBenchmark::RunQueries<MortonTileGrid>(
+        const std::string& layout, const Map<MortonTileGrid>& game_map,
+        const std::vector<Query>& queries, PathfindingAlgorithm algorithm);
+
+template LayoutReport LayoutBenchmark::RunBreadthFirstQueries<MortonTileGrid>(
+        const std::string& layout, const Map<MortonTileGrid>& game_map,
+        const std::vector<Query>& queries);
+
+// Type byte plus bit planes
+
+template LayoutReport LayoutBenchmark::RunQueries<CompactTileGrid>(
+        const std::string& layout, const Map<CompactTileGrid>& game_map,
+        const std::vector<Query>& queries, PathfindingAlgorithm algorithm);
+
+template LayoutReport LayoutBenchmark::RunBreadthFirstQueries<CompactTileGrid>(
+        const std::string& layout, const Map<CompactTileGrid>& game_map,
+        const std::vector<Query>& queries);
+
+// Build-time 64x64 grid
+
+template LayoutReport LayoutBenchmark::RunQueries<FixedGrid<64, 64>>(
+        const std::string& layout, const Map<FixedGrid<64, 64>>& game_map,
+        const std::vector<Query>& queries, PathfindingAlgorithm algorithm);
+
+template LayoutReport LayoutBenchmark::RunBreadthFirstQueries<FixedGrid<64, 64>>(
+        const std::string& layout, const Map<FixedGrid<64, 64>>& game_map,
+        const std::vector<Query>& queries);
+
+// Streamed 64x64 chunks
+
+template LayoutReport LayoutBenchmark::RunQueries<ChunkedTileGrid>(
+        const std::string& layout, const Map<ChunkedTileGrid>& game_map,
+        const std::vector<Query>& queries, PathfindingAlgorithm algorithm);
+
+template LayoutReport LayoutBenchmark::RunBreadthFirstQueries<ChunkedTileGrid>(
+        const std::string& layout, const Map<ChunkedTileGrid>& game_map,
+        const std::vector<Query>& queries);
+
+// Memory-mapped map file
+
+template LayoutReport LayoutBenchmark::RunQueries<MappedTileGrid>(
+        const std::string& layout, const Map<MappedTileGrid>& game_map,
+        const std::vector<Query>& queries, PathfindingAlgorithm algorithm);
+
+template LayoutReport LayoutBenchmark::RunBreadthFirstQueries<MappedTileGrid>(
+        const std::string& layout, const Map<MappedTileGrid>& game_map,
+        const std::vector<Query>& queries);
@@ -0,0 +1,87 @@
+#ifndef RAYLIBSTARTER_LAYOUTBENCHMARK_H
+#define RAYLIBSTARTER_LAYOUTBENCHMARK_H
+
+#include "../Tile.h"
+#include "../Pathfinding.h"
+#include <string>
+#include <vector>
+#include <utility>
+
+// Forward declaration
+template<typename TileContainer> class Map;
+
+// ******************** LAYOUT REPORT STRUCTURE ********************
+
+// One tile container layout running one algorithm over the shared query set
+struct LayoutReport {
+    std::string layout;
+    const char* algorithm_name;
+    int queries;
+    int solved;
+    int cost_mismatches;     // Path cost differs from the first layout's result for the same query
+    long long total_wall_time_ns;
+    long long total_expansions;
+    std::vector<float> costs; // Per query, -1 when no path was found
+
+    LayoutReport()
+            : algorithm_name(""), queries(0), solved(0), cost_mismatches(0),
+              total_wall_time_ns(0), total_expansions(0) {}
+};
+
+// ******************** LAYOUT BENCHMARK CLASS ********************
+
+// Runs identical searches on the same terrain stored in different Map<> containers, so the only
+// difference between the rows is the memory layout of the tiles
+class LayoutBenchmark {
+public:
+    using Query = std::pair<Position, Position>;
+
+    // Expansion cap per query on maps too large for unbounded searches
+    static const int kBoundedExpansionLimit = 200000;
+
+    // Setup: random terrain (30% blocked) and random traversable start/goal pairs
+    static std::vector<TileType> GenerateTerrain(int width, int height, unsigned int seed);
+    static std::vector<Query> GenerateQueries(const std::vector<TileType>& tile_types, int width, int height,
+                                              int count, unsigned int seed);
+
+    // Execution
+    template<typename TileContainer>
+    static LayoutReport RunQueries(const std::string& layout, const Map<TileContainer>& game_map,
+                                   const std::vector<Query>& queries, PathfindingAlgorithm algorithm);
+
+    // Breadth-first search to the goal on the tile-indexed SearchWorkspace. A* keeps its nodes in
+    // hash maps, whose lookups cost the same whatever the layout; here the tile reads dominate
+    template<typename TileContainer>
+    static LayoutReport RunBreadthFirstQueries(const std::string& layout, const Map<TileContainer>& game_map,
+                                               const std::vector<Query>& queries);
+
+    // Reporting
+    static void PrintReport(const std::vector<LayoutReport>& reports, int width, int height);
+    static void PrintStorage(int width, int height);
+
+    // Morton codes of every tile against the shift-and-mask codes; returns the mismatches
+    // (0 unless the BMI2 path is wrong, and trivially 0 when it is not compiled in)
+    static long long CheckMortonCodes(int width, int height);
+
+    // Command line entry, arguments after --layout: [size] [queries]
+    static int RunFromCommandLine(int argc, char** argv);
+
+    // A* on a chunked world, arguments after --streamed: [world size] [queries] [chunk cache MB]
+    static int RunStreamedFromCommandLine(int argc, char** argv);
+
+    // Map file load times and A* on the loaded maps, arguments after --map-file: <path> [size] [queries]
+    static int RunMapFileFromCommandLine(int argc, char** argv);
+
+private:
+    static void CompareCosts(const LayoutReport& reference, LayoutReport& report);
+
+    // Queries a few chunks long scattered over a large map, and A* / octile A* capped at
+    // kBoundedExpansionLimit, since a walled-in start or goal would flood a huge component
+    template<typename TileContainer>
+    static std::vector<Query> GenerateLocalQueries(const Map<TileContainer>& game_map, int count, unsigned int seed);
+    template<typename TileContainer>
+    static LayoutReport RunBoundedQueries(const std::string& layout, const Map<TileContainer>& game_map,
+                                          const std::vector<Query>& queries, bool eight_way);
+};
+
+#endif //RAYLIBSTARTER_LAYOUTBENCHMARK_H
@@ -0,0 +1,416 @@
+#include "MovingAIBenchmark.h"
+#include "../Map.h"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <map>
+#include <cmath>
+#include <algorithm>
+#include <cstdlib>
+
+// ******************** LOADING ********************
+
+template<typename TileContainer>
+bool MovingAIBenchmark::LoadMap(const std::string& file_path, Map<TileContainer>& game_map) {
+    std::ifstream file(file_path);
+    if (!file.is_open()) {
+        std::cout << "Could not open MovingAI map: " << file_path << std::endl;
+        return false;
+    }
+
+    // Header: "type octile", "height H", "width W", "map"
+    int width = 0;
+    int height = 0;
+    std::string keyword;
+    while (file >> keyword) {
+        if (keyword == "type") {
+            std::string type_name;
+            file >> type_name;
+        } else if (keyword == "height") {
+            file >> height;
+        } else if (keyword == "width") {
+            file >> width;
+        } else if (keyword == "map") {
+            break;
+        } else {
+            std::cout << "Unexpected MovingAI header entry '" << keyword << "' in " << file_path << std::endl;
+            return false;
+        }
+    }
+
+    if (width <= 0 || height <= 0) {
+        std::cout << "Invalid MovingAI map size in " << file_path << std::endl;
+        return false;
+    }
+
+    std::vector<TileType> tile_types;
+    tile_types.reserve(static_cast<size_t>(width) * height);
+
+    std::string row;
+    std::getline(file, row); // Rest of the "map" line
+    for (int y = 0; y < height; ++y) {
+        if (!std::getline(file, row) || static_cast<int>(row.size()) < width) {
+            std::cout << "MovingAI map " << file_path << " ends early at row " << y << std::endl;
+            return false;
+        }
+        for (int x = 0; x < width; ++x) {
+            tile_types.push_back(GetTileTypeForTerrainChar(row[x]));
+        }
+    }
+
+    if (!game_map.LoadTerrain(width, height, tile_types)) {
+        std::cout << "Could not load MovingAI map " << file_path << std::endl;
+        return false;
+    }
+    std::cout << "Loaded MovingAI map " << file_path << " (" << width << "x" << height << ")" << std::endl;
+    return true;
+}
+
+bool MovingAIBenchmark::LoadScenarios(const std::string& file_path, std::vector<MovingAIScenario>& scenarios) {
+    std::ifstream file(file_path);
+    if (!file.is_open()) {
+        std::cout << "Could not open MovingAI scenario file: " << file_path << std::endl;
+        return false;
+    }
+
+    std::string line;
+    if (!std::getline(file, line) || line.compare(0, 7, "version") != 0) {
+        std::cout << "Missing version line in " << file_path << std::endl;
+        return false;
+    }
+
+    scenarios.clear();
+    while (std::getline(file, line)) {
+        if (line.empty()) continue;
+
+        std::istringstream stream(line);
+        MovingAIScenario scenario;
+        if (!(stream >> scenario.bucket >> scenario.map_name >> scenario.map_width >> scenario.map_height
+                     >> scenario.start.x >> scenario.start.y >> scenario.goal.x >> scenario.goal.y
+                     >> scenario.optimal_length)) {
+            std::cout << "Skipping malformed scenario line: " << line << std::endl;
+            continue;
+        }
+        scenarios.push_back(scenario);
+    }
+
+    std::cout << "Loaded " << scenarios.size() << " scenarios from " << file_path << std::endl;
+    return !scenarios.empty();
+}
+
+// ******************** EXECUTION ********************
+
+template<typename TileContainer>
+std::vector<MovingAIBucketReport> MovingAIBenchmark::RunScenarios(const std::vector<MovingAIScenario>& scenarios,
+                                                                   const Map<TileContainer>& game_map,
+                                                                   Pathfinding& pathfinder,
+                                                                   PathfindingAlgorithm algorithm,
+                                                                   bool exact_lengths) {
+    std::map<int, MovingAIBucketReport> buckets;
+
+    bool was_verbose = pathfinder.IsVerbose();
+    pathfinder.SetVerbose(false);
+
+    for (const MovingAIScenario& scenario : scenarios) {
+        if (scenario.map_width != game_map.GetWidth() || scenario.map_height != game_map.GetHeight()) {
+            continue; // Scenario belongs to a scaled version of the map
+        }
+
+        MovingAIBucketReport& report = buckets[scenario.bucket];
+        report.bucket = scenario.bucket;
+        report.queries++;
+
+        PathResult result = pathfinder.FindPath(algorithm, scenario.start, scenario.goal, game_map);
+        report.total_wall_time_ns += result.stats.wall_time_ns;
+        report.total_expansions += result.nodes_explored;
+        report.total_bytes_allocated += static_cast<long long>(result.stats.bytes_allocated);
+
+        if (!result.path_found || !IsValidPath(result, scenario, game_map)) {
+            report.failed++;
+            continue;
+        }
+
+        report.solved++;
+        double tolerance = 1e-3 * std::max(1.0, scenario.optimal_length);
+        double cost = result.total_cost;
+        if (cost < scenario.optimal_length - tolerance) {
+            report.below_reference++;
+        }
+        if (exact_lengths && std::fabs(cost - scenario.optimal_length) > tolerance) {
+            report.not_optimal++;
+        }
+        if (scenario.optimal_length > 0.0) {
+            report.total_cost_ratio += cost / scenario.optimal_length;
+        } else {
+            report.total_cost_ratio += 1.0;
+        }
+    }
+
+    pathfinder.SetVerbose(was_verbose);
+
+    std::vector<MovingAIBucketReport> reports;
+    for (const auto& pair : buckets) {
+        reports.push_back(pair.second);
+    }
+    return reports;
+}
+
+template<typename TileContainer>
+bool MovingAIBenchmark::RunUnreachableGoal(const std::vector<MovingAIScenario>& scenarios,
+                                           Map<TileContainer>& game_map, Pathfinding& pathfinder,
+                                           PathfindingAlgorithm algorithm) {
+    auto fits_map = [&](const MovingAIScenario& scenario) {
+        return scenario.map_width == game_map.GetWidth() && scenario.map_height == game_map.GetHeight() &&
+               std::max(std::abs(scenario.start.x - scenario.goal.x), std::abs(scenario.start.y - scenario.goal.y)) > 1;
+    };
+    auto scenario = std::find_if(scenarios.begin(), scenarios.end(), fits_map);
+    if (scenario == scenarios.end()) {
+        std::cout << "No scenario to wall in; unreachable goal check skipped" << std::endl;
+        return true;
+    }
+
+    // All 8 neighbours, so diagonal moves cannot reach the goal either
+    for (int dy = -1; dy <= 1; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) {
+            Position wall(scenario->goal.x + dx, scenario->goal.y + dy);
+            if ((dx != 0 || dy != 0) && game_map.IsValidPosition(wall)) {
+                game_map.SetTileType(wall, TileType::BLOCKED_STONE);
+            }
+        }
+    }
+
+    bool was_verbose = pathfinder.IsVerbose();
+    pathfinder.SetVerbose(false);
+    PathResult result = pathfinder.FindPath(algorithm, scenario->start, scenario->goal, game_map);
+    pathfinder.SetVerbose(was_verbose);
+
+    std::cout << "Unreachable goal (" << scenario->goal.x << ", " << scenario->goal.y << "): "
+              << (result.path_found ? "path reported (wrong)" : "no path") << " after "
+              << (result.stats.wall_time_ns / 1000) << " us, " << result.nodes_explored << " expansions" << std::endl;
+    return !result.path_found;
+}
+
+template<typename TileContainer>
+bool MovingAIBenchmark::IsValidPath(const PathResult& result, const MovingAIScenario& scenario,
+                                    const Map<TileContainer>& game_map) {
+    const std::vector<Position>& path = result.path;
+    if (path.empty() || path.front() != scenario.start || path.back() != scenario.goal) {
+        return false;
+    }
+
+    for (size_t i = 0; i < path.size(); ++i) {
+        if (!game_map.IsValidPosition(path[i]) || !game_map.GetTile(path[i]).IsTraversable()) {
+            return false;
+        }
+        if (i > 0) {
+            int dx = std::abs(path[i].x - path[i - 1].x);
+            int dy = std::abs(path[i].y - path[i - 1].y);
+            if (dx > 1 || dy > 1 || (dx == 0 && dy == 0)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// ******************** REPORTING ********************
+
+void MovingAIBenchmark::PrintReport(const std::vector<MovingAIBucketReport>& reports, const char* algorithm_name) {
+    std::cout << "\n" << std::string(90, '=') << std::endl;
+    std::cout << "           MOVINGAI BENCHMARK: " << algorithm_name << std::endl;
+    std::cout << std::string(90, '=') << std::endl;
+
+    std::cout << "Bucket | Queries | Solved | Failed | <Ref | !Opt | Cost/Ref | Avg us | Avg Exp | Avg KB | Queries/s" << std::endl;
+    std::cout << "-------|---------|--------|--------|------|------|----------|--------|---------|--------|----------" << std::endl;
+
+    MovingAIBucketReport total;
+    for (const MovingAIBucketReport& report : reports) {
+        double seconds = report.total_wall_time_ns / 1e9;
+        int queries = std::max(1, report.queries);
+
+        std::cout << std::setw(6) << report.bucket
+                  << " | " << std::setw(7) << report.queries
+                  << " | " << std::setw(6) << report.solved
+                  << " | " << std::setw(6) << report.failed
+                  << " | " << std::setw(4) << report.below_reference
+                  << " | " << std::setw(4) << report.not_optimal
+                  << " | " << std::setw(8) << std::fixed << std::setprecision(3)
+                  << (report.total_cost_ratio / std::max(1, report.solved))
+                  << " | " << std::setw(6) << (report.total_wall_time_ns / queries / 1000)
+                  << " | " << std::setw(7) << (report.total_expansions / queries)
+                  << " | " << std::setw(6) << (report.total_bytes_allocated / queries / 1024)
+                  << " | " << std::setw(9) << std::setprecision(0)
+                  << (seconds > 0.0 ? report.queries / seconds : 0.0) << std::endl;
+
+        total.queries += report.queries;
+        total.solved += report.solved;
+        total.failed += report.failed;
+        total.below_reference += report.below_reference;
+        total.not_optimal += report.not_optimal;
+        total.total_wall_time_ns += report.total_wall_time_ns;
+        total.total_bytes_allocated += report.total_bytes_allocated;
+    }
+
+    std::cout << std::setprecision(6) << std::defaultfloat;
+    double total_seconds = total.total_wall_time_ns / 1e9;
+    std::cout << "\nTotal: " << total.queries << " queries, " << total.solved << " solved, "
+              << total.failed << " failed, " << total.below_reference << " below reference, "
+              << total.not_optimal << " not optimal" << std::endl;
+    std::cout << "Throughput: " << (total_seconds > 0.0 ? total.queries / total_seconds : 0.0)
+              << " queries/s, average search memory "
+              << (total.total_bytes_allocated / std::max(1, total.queries) / 1024) << " KB" << std::endl;
+    std::cout << std::string(90, '=') << std::endl;
+}
+
+// ******************** COMMAND LINE ENTRY ********************
+
+int MovingAIBenchmark::RunFromCommandLine(int argc, char** argv) {
+    if (argc < 2) {
+        std::cout << "Usage: <map file> <scen file> [astar|astar8|dijkstra|sub|rsr|ida|sma]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    PathfindingAlgorithm algorithm = PathfindingAlgorithm::A_STAR;
+    if (argc >= 3) {
+        std::string algorithm_name = argv[2];
+        if (algorithm_name == "astar8") {
+            algorithm = PathfindingAlgorithm::A_STAR_OCTILE;
+        } else if (algorithm_name == "dijkstra") {
+            algorithm = PathfindingAlgorithm::DIJKSTRA;
+        } else if (algorithm_name == "sub") {
+            algorithm = PathfindingAlgorithm::SUBGOAL_GRAPH;
+        } else if (algorithm_name == "rsr") {
+            algorithm = PathfindingAlgorithm::RECTANGULAR_SYMMETRY_REDUCTION;
+        } else if (algorithm_name == "ida") {
+            algorithm = PathfindingAlgorithm::IDA_STAR;
+        } else if (algorithm_name == "sma") {
+            algorithm = PathfindingAlgorithm::SMA_STAR;
+        }
+    }
+
+    Map<> game_map;
+    std::vector<MovingAIScenario> scenarios;
+    if (!LoadMap(argv[0], game_map) || !LoadScenarios(argv[1], scenarios)) {
+        return EXIT_FAILURE;
+    }
+
+    Pathfinding pathfinder;
+    // Only the 8-way search moves like the reference, so only its lengths can be compared exactly
+    bool exact_lengths = algorithm == PathfindingAlgorithm::A_STAR_OCTILE;
+    std::vector<MovingAIBucketReport> reports = RunScenarios(scenarios, game_map, pathfinder, algorithm,
+                                                             exact_lengths);
+    PrintReport(reports, Pathfinding::GetAlgorithmName(algorithm));
+
+    // Changes the map, so it runs last
+    if (!RunUnreachableGoal(scenarios, game_map, pathfinder, algorithm)) {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+// ******************** UTILITY ********************
+
+TileType MovingAIBenchmark::GetTileTypeForTerrainChar(char terrain) {
+    switch (terrain) {
+        case '.':
+        case 'G': return TileType::TRAVERSABLE_GRASS;
+        case 'S': return TileType::TRAVERSABLE_DIRT;   // Swamp is passable
+        case 'T': return TileType::BLOCKED_TREE;
+        case 'W': return TileType::BLOCKED_WATER;
+        case '@':
+        case 'O':
+        default: return TileType::BLOCKED_STONE;       // Out of bounds / unknown
+    }
+}
+
+// ******************** EXPLICIT TEMPLATE INSTANTIATIONS ********************
+
+template bool MovingAIBenchmark::LoadMap<std::vector<std::vector<Tile>>>(
+        const std::string& file_path, Map<std::vector<std::vector<Tile>>>& game_map);
+
+template std::vector<MovingAIBucketReport> MovingAIBenchmark::RunScenarios<std::vector<std::vector<Tile>>>(
+        const std::vector<MovingAIScenario>& scenarios, const Map<std::vector<std::vector<Tile>>>& game_map,
+        Pathfinding& pathfinder, PathfindingAlgorithm algorithm, bool exact_lengths);
+
+template bool MovingAIBenchmark::RunUnreachableGoal<std::vector<std::vector<Tile>>>(
+        const std::vector<MovingAIScenario>& scenarios, Map<std::vector<std::vector<Tile>>>& game_map,
+        Pathfinding& pathfinder, PathfindingAlgorithm algorithm);
+
+// Flat row-major grid (the default Map<> container)
+
+template bool MovingAIBenchmark::LoadMap<FlatTileGrid>(
+        const std::string& file_path, Map<FlatTileGrid>& game_map);
+
+template std::vector<MovingAIBucketReport> MovingAIBenchmark::RunScenarios<FlatTileGrid>(
+        const std::vector<MovingAIScenario>& scenarios, const Map<FlatTileGrid>& game_map,
+        Pathfinding& pathfinder, PathfindingAlgorithm algorithm, bool exact_lengths);
+
+template bool MovingAIBenchmark::RunUnreachableGoal<FlatTileGrid>(
+        const std::vector<MovingAIScenario>& scenarios, Map<FlatTileGrid>& game_map,
+        Pathfinding& pathfinder, PathfindingAlgorithm algorithm);
+
+// Morton-ordered 8x8 blocks
+
+template bool MovingAIBenchmark::LoadMap<MortonTileGrid>(
+        const std::string& file_path, Map<MortonTileGrid>& game_map);
+
+template std::vector<MovingAIBucketReport> MovingAIBenchmark::RunScenarios<MortonTileGrid>(
+        const std::vector<MovingAIScenario>& scenarios, const Map<MortonTileGrid>& game_map,
+        Pathfinding& pathfinder, PathfindingAlgorithm algorithm, bool exact_lengths);
+
+template bool MovingAIBenchmark::RunUnreachableGoal<MortonTileGrid>(
+        const std::vector<MovingAIScenario>& scenarios, Map<MortonTileGrid>& game_map,
+        Pathfinding& pathfinder, PathfindingAlgorithm algorithm);
+
+// Type byte plus bit planes
+
+template bool MovingAIBenchmark::LoadMap<CompactTileGrid>(
+        const std::string& file_path, Map<CompactTileGrid>& game_map);
+
+template std::vector<MovingAIBucketReport> MovingAIBenchmark::RunScenarios<CompactTileGrid>(
+        const std::vector<MovingAIScenario>& scenarios, const Map<CompactTileGrid>& game_map,
+        Pathfinding& pathfinder, PathfindingAlgorithm algorithm, bool exact_lengths);
+
+template bool MovingAIBenchmark::RunUnreachableGoal<CompactTileGrid>(
+        const std::vector<MovingAIScenario>& scenarios, Map<CompactTileGrid>& game_map,
+        Pathfinding& pathfinder, PathfindingAlgorithm algorithm);
+
+// Build-time 64x64 grid
+
+template bool MovingAIBenchmark::LoadMap<FixedGrid<64, 64>>(
+        const std::string& file_path, Map<FixedGrid<64, 64>>& game_map);
+
+template std::vector<MovingAIBucketReport> MovingAIBenchmark::RunScenarios<FixedGrid<64, 64>>(
+        const std::vector<MovingAIScenario>& scenarios, const Map<FixedGrid<64, 64>>& game_map,
+        Pathfinding& pathfinder, PathfindingAlgorithm algorithm, bool exact_lengths);
+
+template bool MovingAIBenchmark::RunUnreachableGoal<FixedGrid<64, 64>>(
+        const std::vector<MovingAIScenario>& scenarios, Map<FixedGrid<64, 64>>& game_map,
+        Pathfinding& pathfinder, PathfindingAlgorithm algorithm);
+
+// Streamed 64x64 chunks
+
+template bool MovingAIBenchmark::LoadMap<ChunkedTileGrid>(
+        const std::string& file_path, Map<ChunkedTileGrid>& game_map);
+
+template std::vector<MovingAIBucketReport> MovingAIBenchmark::RunScenarios<ChunkedTileGrid>(
+        const std::vector<MovingAIScenario>& scenarios, const Map<ChunkedTileGrid>& game_map,
+        Pathfinding& pathfinder, PathfindingAlgorithm algorithm, bool exact_lengths);
+
+template bool MovingAIBenchmark::RunUnreachableGoal<ChunkedTileGrid>(
+        const std::vector<MovingAIScenario>& scenarios, Map<ChunkedTileGrid>& game_map,
+        Pathfinding& pathfinder, PathfindingAlgorithm algorithm);
+
+// Memory-mapped map file
+
+template bool MovingAIBenchmark::LoadMap<MappedTileGrid>(
+        const std::string& file_path, Map<MappedTileGrid>& game_map);
+
+template std::vector<MovingAIBucketReport> MovingAIBenchmark::RunScenarios<MappedTileGrid>(
+        const std::vector<MovingAIScenario>& scenarios, const Map<MappedTileGrid>& game_map,
+        Pathfinding& pathfinder, PathfindingAlgorithm algorithm, bool exact_lengths);
+
+template bool MovingAIBenchmark::RunUnreachableGoal<MappedTileGrid>(
+        const std::vector<MovingAIScenario>& scenarios, Map<MappedTileGrid>& game_map,
+        Pathfinding& pathfinder, PathfindingAlgorithm algorithm);
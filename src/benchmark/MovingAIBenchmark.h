@@ -0,0 +1,86 @@
+#ifndef RAYLIBSTARTER_MOVINGAIBENCHMARK_H
+#define RAYLIBSTARTER_MOVINGAIBENCHMARK_H
+
+#include "../Tile.h"
+#include "../Pathfinding.h"
+#include <string>
+#include <vector>
+
+// Forward declaration
+template<typename TileContainer> class Map;
+
+// ******************** SCENARIO STRUCTURE ********************
+
+// One line of a MovingAI .scen file
+struct MovingAIScenario {
+    int bucket;
+    std::string map_name;
+    int map_width;
+    int map_height;
+    Position start;
+    Position goal;
+    double optimal_length;  // Reference length published with the benchmark
+
+    MovingAIScenario() : bucket(0), map_width(0), map_height(0), optimal_length(0.0) {}
+};
+
+// ******************** BUCKET REPORT STRUCTURE ********************
+
+struct MovingAIBucketReport {
+    int bucket;
+    int queries;
+    int solved;              // Path found where the reference has one
+    int failed;              // No path (or an invalid path) where the reference has one
+    int below_reference;     // Cost lower than the reference optimum: the result cannot be right
+    int not_optimal;         // Cost differs from the reference (only checked in exact mode)
+    double total_cost_ratio; // Sum of found cost / reference cost over solved queries
+    long long total_wall_time_ns;
+    long long total_expansions;
+    long long total_bytes_allocated; // Peak search memory summed over queries
+
+    MovingAIBucketReport()
+            : bucket(0), queries(0), solved(0), failed(0), below_reference(0), not_optimal(0),
+              total_cost_ratio(0.0), total_wall_time_ns(0), total_expansions(0), total_bytes_allocated(0) {}
+};
+
+// ******************** MOVINGAI BENCHMARK CLASS ********************
+
+class MovingAIBenchmark {
+public:
+    // Loading
+    template<typename TileContainer>
+    static bool LoadMap(const std::string& file_path, Map<TileContainer>& game_map);
+    static bool LoadScenarios(const std::string& file_path, std::vector<MovingAIScenario>& scenarios);
+
+    // Execution
+    // exact_lengths: the search uses the same movement model as the reference lengths
+    // (octile, 8-way). With 4-way movement only lower-bound and reachability checks apply.
+    template<typename TileContainer>
+    static std::vector<MovingAIBucketReport> RunScenarios(const std::vector<MovingAIScenario>& scenarios,
+                                                          const Map<TileContainer>& game_map,
+                                                          Pathfinding& pathfinder,
+                                                          PathfindingAlgorithm algorithm,
+                                                          bool exact_lengths = false);
+
+    // Walls in the goal of the first scenario that fits the map and queries it again: the search
+    // must report that no path exists, and do so quickly; returns false if it finds a path
+    template<typename TileContainer>
+    static bool RunUnreachableGoal(const std::vector<MovingAIScenario>& scenarios, Map<TileContainer>& game_map,
+                                   Pathfinding& pathfinder, PathfindingAlgorithm algorithm);
+
+    // Reporting
+    static void PrintReport(const std::vector<MovingAIBucketReport>& reports, const char* algorithm_name);
+
+    // Command line entry, arguments after --movingai: <map file> <scen file> [astar|astar8|dijkstra|sub|rsr|ida|sma]
+    static int RunFromCommandLine(int argc, char** argv);
+
+    // Utility
+    static TileType GetTileTypeForTerrainChar(char terrain);
+
+private:
+    template<typename TileContainer>
+    static bool IsValidPath(const PathResult& result, const MovingAIScenario& scenario,
+                            const Map<TileContainer>& game_map);
+};
+
+#endif //RAYLIBSTARTER_MOVINGAIBENCHMARK_H
@@ -692,6 +692,35 @@ int InventorySystem::GetUsedInventorySlots() const {
 
     return player_inventory_->GetUsedSlots();
 }
+
+int InventorySystem::GetBombCount() const {
+    if (!player_inventory_) {
+        return 0;
+    }
+
+    int bomb_count = 0;
+    for (int slot = 0; slot < player_inventory_->GetMaxSlots(); ++slot) {
+        if (dynamic_cast<const ConsumablesBomb*>(player_inventory_->GetItem(slot))) {
+            bomb_count++;
+        }
+    }
+    return bomb_count;
+}
+
+bool InventorySystem::UseBomb() {
+    if (!player_inventory_) {
+        return false;
+    }
+
+    for (int slot = 0; slot < player_inventory_->GetMaxSlots(); ++slot) {
+        if (dynamic_cast<const ConsumablesBomb*>(player_inventory_->GetItem(slot))) {
+            std::unique_ptr<ItemBase> bomb = player_inventory_->RemoveItem(slot);
+            bomb->Use();
+            return true;
+        }
+    }
+    return false;
+}
 // ******************** INVENTORY SORTING ALGORITHMS ********************
 
 void InventorySystem::SortByWeight(bool ascending) {
@@ -62,6 +62,10 @@ public:
     int GetMaxInventorySlots() const;
     int GetUsedInventorySlots() const;
 
+    // Bombs (used by navigation to blast through blocked tiles)
+    int GetBombCount() const;
+    bool UseBomb();
+
     // Inventory sorting methods
     void SortByWeight(bool ascending = true);
     void SortByName(bool ascending = true);
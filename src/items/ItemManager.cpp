@@ -99,6 +99,13 @@ void ItemManager::ClearAllItems() {
     treasure_chest_positions_.clear();
 }
 
+void ItemManager::AddItem(const Position& pos, std::unique_ptr<ItemBase> item, bool in_treasure_chest) {
+    items_.emplace_back(pos, std::move(item), in_treasure_chest);
+    if (in_treasure_chest) {
+        treasure_chest_positions_.push_back(pos);
+    }
+}
+
 // ******************** ITEM ACCESS ********************
 
 std::vector<ItemManager::ItemWithPosition*> ItemManager::GetItemsAtPosition(const Position& pos) {
@@ -219,6 +226,38 @@ std::unique_ptr<ItemBase> ItemManager::CreateRandomItemByWeight() {
     return CreateRandomItem(rarity);
 }
 
+// ******************** ITEM PERSISTENCE ********************
+
+std::string ItemManager::GetItemTypeKey(const ItemBase& item) {
+    if (dynamic_cast<const CurrencyKittyCoin*>(&item)) return "KittyCoin";
+    if (dynamic_cast<const ConsumablesHealthPotion*>(&item)) return "HealthPotion";
+    if (dynamic_cast<const ConsumablesBomb*>(&item)) return "Bomb";
+    if (dynamic_cast<const WeaponSword*>(&item)) return "Sword";
+    if (dynamic_cast<const WeaponStaff*>(&item)) return "Staff";
+    if (dynamic_cast<const GemstoneBlue*>(&item)) return "BlueGemstone";
+    if (dynamic_cast<const ArmorKittyBoots*>(&item)) return "KittyBoots";
+    if (dynamic_cast<const ArmorElderWings*>(&item)) return "ElderWings";
+    if (dynamic_cast<const AccessoryLuckyPaw*>(&item)) return "LuckyPaw";
+    if (dynamic_cast<const AccessoryClawNecklace*>(&item)) return "ClawNecklace";
+
+    std::cout << "Unknown item type for " << item.GetName() << ", saved as a kitty coin" << std::endl;
+    return "KittyCoin";
+}
+
+int ItemManager::GetItemStackCount(const ItemBase& item) {
+    const CurrencyItem* currency = dynamic_cast<const CurrencyItem*>(&item);
+    return currency ? currency->GetStackCount() : 1;
+}
+
+std::unique_ptr<ItemBase> ItemManager::CreateItemOfType(const std::string& item_type, int stack_count) {
+    std::unique_ptr<ItemBase> item = CreateSpecificItem(item_type, ItemRarity::COMMON);
+    CurrencyItem* currency = dynamic_cast<CurrencyItem*>(item.get());
+    if (currency && stack_count > 0) {
+        currency->SetStackCount(stack_count);
+    }
+    return item;
+}
+
 // ******************** PRIVATE HELPERS ********************
 
 ItemRarity ItemManager::GetRandomRarity() {
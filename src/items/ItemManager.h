@@ -40,6 +40,7 @@ public:
     // Item generation
     void GenerateItemsForMap(int map_width, int map_height, int min_items = 5);
     void ClearAllItems();
+    void AddItem(const Position& pos, std::unique_ptr<ItemBase> item, bool in_treasure_chest);
 
     // Item access
     const std::vector<ItemWithPosition>& GetAllItems() const { return items_; }
@@ -60,6 +61,11 @@ public:
     static std::unique_ptr<ItemBase> CreateRandomItemByWeight();
     static std::vector<Position> GetTreasureChestPositions() { return treasure_chest_positions_; }
 
+    // Item persistence (map files store the type key and stack count of each item)
+    static std::string GetItemTypeKey(const ItemBase& item);
+    static int GetItemStackCount(const ItemBase& item);
+    static std::unique_ptr<ItemBase> CreateItemOfType(const std::string& item_type, int stack_count);
+
     std::vector<ItemWithPosition> items_;
 private:
     static std::vector<Position> treasure_chest_positions_;
@@ -1,11 +1,39 @@
 ﻿#include "Game.h"
+#include "benchmark/MovingAIBenchmark.h"
+#include "benchmark/LayoutBenchmark.h"
+#include "benchmark/GenerationBenchmark.h"
 #include <cstdlib>
 #include <iostream>
 #include <stdexcept>
 
 // ******************** MAIN FUNCTION ********************
 
-int main() {
+int main(int argc, char** argv) {
+    // Headless benchmark mode: game --movingai <map file> <scen file> [astar|astar8|dijkstra|sub|rsr|ida|sma]
+    if (argc >= 2 && std::string(argv[1]) == "--movingai") {
+        return MovingAIBenchmark::RunFromCommandLine(argc - 2, argv + 2);
+    }
+
+    // Tile layout comparison on generated terrain: game --layout [size] [queries]
+    if (argc >= 2 && std::string(argv[1]) == "--layout") {
+        return LayoutBenchmark::RunFromCommandLine(argc - 2, argv + 2);
+    }
+
+    // A* on a streamed world far larger than memory: game --streamed [world size] [queries] [cache MB]
+    if (argc >= 2 && std::string(argv[1]) == "--streamed") {
+        return LayoutBenchmark::RunStreamedFromCommandLine(argc - 2, argv + 2);
+    }
+
+    // Zero-copy map file loading: game --map-file <path> [size] [queries]
+    if (argc >= 2 && std::string(argv[1]) == "--map-file") {
+        return LayoutBenchmark::RunMapFileFromCommandLine(argc - 2, argv + 2);
+    }
+
+    // Banded terrain generation on 1..N threads: game --generate [size] [seed]
+    if (argc >= 2 && std::string(argv[1]) == "--generate") {
+        return GenerationBenchmark::RunFromCommandLine(argc - 2, argv + 2);
+    }
+
     try {
         // Create and run game
         Game game;